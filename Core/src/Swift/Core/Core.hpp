@@ -20,12 +20,24 @@ namespace Swift
             return std::make_shared<T>(std::forward<Args>(args)...);
         }
 
+        // Note(Jorben): Only one backend is ever compiled in, so the cast can't fail at runtime. We still verify it in debug builds.
         template<typename T, typename T2>
-        static Ref<T> RefAs(Ref<T2> ptr)
+        static Ref<T> RefAs(const Ref<T2>& ptr)
         {
-            Ref<T> newPtr = std::dynamic_pointer_cast<T>(ptr);
-            APP_ASSERT(newPtr, "Assertion Failed: Failed to cast from Ref<T> to Ref<T2>");
-            return newPtr;
+            #if defined(APP_DEBUG)
+            APP_ASSERT((std::dynamic_pointer_cast<T>(ptr) != nullptr), "Assertion Failed: Failed to cast from Ref<T> to Ref<T2>");
+            #endif
+            return std::static_pointer_cast<T>(ptr);
+        }
+
+        // Note(Jorben): Same as RefAs, but doesn't touch the reference count. Use this for hot paths where the pointer doesn't outlive the call.
+        template<typename T, typename T2>
+        static T* RawAs(const Ref<T2>& ptr)
+        {
+            #if defined(APP_DEBUG)
+            APP_ASSERT((dynamic_cast<T*>(ptr.get()) != nullptr), "Assertion Failed: Failed to cast from Ref<T> to T*");
+            #endif
+            return static_cast<T*>(ptr.get());
         }
     };
 
@@ -0,0 +1,109 @@
+#include "swpch.h"
+#include "FrameScheduler.hpp"
+
+#include "Swift/Utils/Utils.hpp"
+#include "Swift/Utils/Profiler.hpp"
+
+#if defined(APP_PLATFORM_WINDOWS)
+	#include <Windows.h>
+	#include <timeapi.h>
+	#pragma comment(lib, "winmm.lib")
+#endif
+
+namespace Swift
+{
+
+	// Note(Jorben): Sleeping is only precise to about a millisecond once the timer resolution is raised, the remainder gets spun.
+	// Without it Windows sleeps in steps of the default timer interval (~15.6ms).
+	static constexpr const uint64_t s_SpinThreshold = 2'000'000;
+	static constexpr const uint64_t s_DefaultTimerSpinThreshold = 16'000'000;
+
+	FrameScheduler::FrameScheduler(const FrameSchedulerSpecification& specs)
+		: m_Specification(specs)
+	{
+		if (m_Specification.UpdateRate)
+			m_Step = 1'000'000'000ull / m_Specification.UpdateRate;
+		if (m_Specification.FrameRateCap)
+			m_FrameDuration = 1'000'000'000ull / m_Specification.FrameRateCap;
+
+		m_SpinThreshold = s_SpinThreshold;
+		#if defined(APP_PLATFORM_WINDOWS)
+		if (m_FrameDuration)
+		{
+			m_TimerResolution = (timeBeginPeriod(1) == TIMERR_NOERROR);
+			if (!m_TimerResolution)
+				m_SpinThreshold = s_DefaultTimerSpinThreshold;
+		}
+		#endif
+
+		m_LastFrame = Utils::ToolKit::GetTimeNanoseconds();
+		m_NextFrame = m_LastFrame + m_FrameDuration;
+	}
+
+	FrameScheduler::~FrameScheduler()
+	{
+		#if defined(APP_PLATFORM_WINDOWS)
+		if (m_TimerResolution)
+			timeEndPeriod(1);
+		#endif
+	}
+
+	float FrameScheduler::BeginFrame()
+	{
+		uint64_t now = Utils::ToolKit::GetTimeNanoseconds();
+		uint64_t elapsed = now - m_LastFrame;
+		m_LastFrame = now;
+
+		if (m_Step)
+		{
+			// Note(Jorben): Spiral of death clamp
+			m_Accumulator = std::min(m_Accumulator + elapsed, m_Step * m_Specification.MaxUpdatesPerFrame);
+			m_Steps = 0;
+		}
+
+		return (float)((double)elapsed / 1e9);
+	}
+
+	bool FrameScheduler::FixedStep()
+	{
+		if (!m_Step || m_Accumulator < m_Step || m_Steps >= m_Specification.MaxUpdatesPerFrame)
+			return false;
+
+		m_Accumulator -= m_Step;
+		m_Steps++;
+		return true;
+	}
+
+	void FrameScheduler::EndFrame()
+	{
+		if (!m_FrameDuration)
+			return;
+
+		APP_PROFILE_SCOPE("FrameScheduler::Wait");
+
+		uint64_t now = Utils::ToolKit::GetTimeNanoseconds();
+		if (now < m_NextFrame)
+		{
+			uint64_t remaining = m_NextFrame - now;
+			if (remaining > m_SpinThreshold)
+				std::this_thread::sleep_for(std::chrono::nanoseconds(remaining - m_SpinThreshold));
+
+			while (Utils::ToolKit::GetTimeNanoseconds() < m_NextFrame)
+				std::this_thread::yield();
+
+			m_NextFrame += m_FrameDuration;
+		}
+		else
+		{
+			// Note(Jorben): We're behind, don't try to catch up by rushing the next frames
+			m_NextFrame = now + m_FrameDuration;
+		}
+	}
+
+	void FrameScheduler::Resume()
+	{
+		m_LastFrame = Utils::ToolKit::GetTimeNanoseconds();
+		m_NextFrame = m_LastFrame + m_FrameDuration;
+	}
+
+}
\ No newline at end of file
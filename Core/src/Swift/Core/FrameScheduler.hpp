@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace Swift
+{
+
+	struct FrameSchedulerSpecification
+	{
+	public:
+		uint32_t UpdateRate = 0; // Note(Jorben): Fixed updates per second, 0 disables Layer::OnFixedUpdate
+		uint32_t MaxUpdatesPerFrame = 5; // Note(Jorben): Time beyond this many fixed updates gets dropped, so a slow frame can't cause even slower frames
+		uint32_t FrameRateCap = 0; // Note(Jorben): 0 means uncapped
+	};
+
+	// Note(Jorben): Keeps track of frame timing, runs the fixed update steps and paces the frames.
+	class FrameScheduler
+	{
+	public:
+		FrameScheduler(const FrameSchedulerSpecification& specs);
+		virtual ~FrameScheduler();
+
+		// Note(Jorben): Returns the variable delta time (in seconds) since the last frame started.
+		float BeginFrame();
+		// Note(Jorben): Returns true while there is time left for another fixed step, consuming that step.
+		bool FixedStep();
+		// Note(Jorben): Waits until the next frame is allowed to start, sleeps for most of the time and spins the rest.
+		void EndFrame();
+		// Note(Jorben): Restarts the frame timing after being idle, so the idle time doesn't end up in the next delta time.
+		void Resume();
+
+		inline float GetFixedDeltaTime() const { return (float)((double)m_Step / 1e9); }
+		// Note(Jorben): How far we are between the last fixed step and the next (0 to 1), used for interpolating the rendered state.
+		inline float GetAlpha() const { return m_Step ? (float)((double)m_Accumulator / (double)m_Step) : 1.0f; }
+
+		inline const FrameSchedulerSpecification& GetSpecification() const { return m_Specification; }
+
+	private:
+		FrameSchedulerSpecification m_Specification = {};
+
+		uint64_t m_Step = 0; // Note(Jorben): All the times are in nanoseconds
+		uint64_t m_FrameDuration = 0;
+		uint64_t m_SpinThreshold = 0; // Note(Jorben): The part of the wait that gets spun instead of slept, depends on the timer resolution
+		bool m_TimerResolution = false; // Note(Jorben): Whether we raised the system timer resolution (Windows)
+
+		uint64_t m_LastFrame = 0;
+		uint64_t m_NextFrame = 0;
+		uint64_t m_Accumulator = 0;
+		uint32_t m_Steps = 0;
+	};
+
+}
\ No newline at end of file
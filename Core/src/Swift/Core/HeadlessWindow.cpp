@@ -0,0 +1,44 @@
+#include "swpch.h"
+#include "HeadlessWindow.hpp"
+
+#include "Swift/Utils/Profiler.hpp"
+
+namespace Swift
+{
+
+	HeadlessWindow::HeadlessWindow(const WindowSpecification& properties)
+	{
+		m_Data.Name = properties.Name;
+		m_Data.Width = properties.Width;
+		m_Data.Height = properties.Height;
+		m_Data.VSync = false; // Note(Jorben): There is nothing to synchronize with
+	}
+
+	void HeadlessWindow::OnUpdate()
+	{
+	}
+
+	void HeadlessWindow::OnRender()
+	{
+		APP_MARK_FRAME;
+	}
+
+	void HeadlessWindow::WaitEvents(float timeout)
+	{
+		APP_PROFILE_SCOPE("WaitEvents");
+
+		std::unique_lock<std::mutex> lock(m_WaitMutex);
+		m_WaitCondition.wait_for(lock, std::chrono::duration<float>(timeout), [this]() { return m_Woken; });
+		m_Woken = false;
+	}
+
+	void HeadlessWindow::Wake()
+	{
+		{
+			std::scoped_lock<std::mutex> lock(m_WaitMutex);
+			m_Woken = true;
+		}
+		m_WaitCondition.notify_all();
+	}
+
+}
\ No newline at end of file
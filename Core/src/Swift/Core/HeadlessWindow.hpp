@@ -0,0 +1,55 @@
+#pragma once
+
+#include <mutex>
+#include <condition_variable>
+
+#include "Swift/Core/Window.hpp"
+
+namespace Swift
+{
+
+	// Note(Jorben): A window without a window system, used when ApplicationSpecification::Headless is set.
+	// It never creates a native window, so no events are generated and rendering happens to offscreen images.
+	class HeadlessWindow : public Window
+	{
+	public:
+		HeadlessWindow(const WindowSpecification& properties);
+		virtual ~HeadlessWindow() = default;
+
+		void SetEventCallBack(EventCallBackFunction func) override { m_Data.CallBack = func; }
+
+		void OnUpdate() override;
+		void OnRender() override;
+
+		void WaitEvents(float timeout) override;
+		void Wake() override;
+
+		uint32_t GetWidth() const override { return m_Data.Width; }
+		uint32_t GetHeight() const override { return m_Data.Height; }
+
+		uint32_t GetPositionX() const override { return 0u; }
+		uint32_t GetPositionY() const override { return 0u; }
+
+		uint32_t GetMonitorWidth() const override { return m_Data.Width; }
+		uint32_t GetMonitorHeight() const override { return m_Data.Height; }
+
+		bool IsFocused() const override { return true; }
+
+		void SetVSync(bool enabled) override { m_Data.VSync = enabled; }
+		bool IsVSync() const override { return m_Data.VSync; }
+
+		void SetTitle(const std::string& title) override { m_Data.Name = title; }
+
+		void* GetNativeWindow() const override { return nullptr; }
+
+	private:
+		WindowData m_Data = {};
+
+		// Note(Jorben): Since there are no events, waiting only ends on a timeout or a Wake()
+		std::mutex m_WaitMutex = {};
+		std::condition_variable m_WaitCondition = {};
+		bool m_Woken = false;
+
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Swift/Core/Input/Input.hpp"
+
+namespace Swift
+{
+
+	// Note(Jorben): Used in headless mode, nothing is ever pressed and the cursor stays at the origin.
+	class HeadlessInput : public Input
+	{
+	public:
+		HeadlessInput() = default;
+		virtual ~HeadlessInput() = default;
+
+		bool IsKeyPressedImplementation(Key keycode) override { return false; }
+		bool IsMousePressedImplementation(MouseButton button) override { return false; }
+
+		glm::vec2 GetMousePositionImplementation() override { return { 0.0f, 0.0f }; }
+
+		void SetCursorPositionImplementation(glm::vec2 position) override {}
+		void SetCursorModeImplementation(CursorMode mode) override {}
+	};
+
+}
\ No newline at end of file
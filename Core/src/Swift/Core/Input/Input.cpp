@@ -2,18 +2,31 @@
 #include "Input.hpp"
 
 #include "Swift/Core/Logging.hpp"
+#include "Swift/Core/Input/HeadlessInput.hpp"
 
-#include "Swift/Platforms/Windows/WindowsInput.hpp"
+#if defined(APP_PLATFORM_WINDOWS)
+	#include "Swift/Platforms/Windows/WindowsInput.hpp"
+#elif defined(APP_PLATFORM_LINUX)
+	#include "Swift/Platforms/Linux/LinuxInput.hpp"
+#endif
 
 namespace Swift
 {
 
 	Input* Input::s_Instance = nullptr;
 
-	void Input::Init()
+	void Input::Init(bool headless)
 	{
-		#ifdef APP_PLATFORM_WINDOWS
+		if (headless)
+		{
+			s_Instance = new HeadlessInput();
+			return;
+		}
+
+		#if defined(APP_PLATFORM_WINDOWS)
 		s_Instance = new WindowsInput();
+		#elif defined(APP_PLATFORM_LINUX)
+		s_Instance = new LinuxInput();
 		#endif
 	}
 
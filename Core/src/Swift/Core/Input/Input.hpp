@@ -23,7 +23,7 @@ namespace Swift
 	class Input
 	{
 	public:
-		static void Init();
+		static void Init(bool headless = false);
 		static void Destroy();
 
 		inline static bool IsKeyPressed(Key keycode) { return s_Instance->IsKeyPressedImplementation(keycode); }
@@ -1,14 +1,45 @@
 #include "swpch.h"
 #include "Layer.hpp"
 
+#include "Swift/Core/Application.hpp"
+
+#include "Swift/Utils/Profiler.hpp"
+
 namespace Swift
 {
 
+	bool LayerDependencies::ConflictsWith(const LayerDependencies& other) const
+	{
+		if (!Parallel || !other.Parallel)
+			return true;
+
+		for (const auto& write : Writes)
+		{
+			if (std::find(other.Reads.begin(), other.Reads.end(), write) != other.Reads.end())
+				return true;
+			if (std::find(other.Writes.begin(), other.Writes.end(), write) != other.Writes.end())
+				return true;
+		}
+
+		for (const auto& read : Reads)
+		{
+			if (std::find(other.Writes.begin(), other.Writes.end(), read) != other.Writes.end())
+				return true;
+		}
+
+		return false;
+	}
+
 	Layer::Layer(const std::string& LayerName)
 		: m_DebugName(LayerName)
 	{
 	}
 
+	void Layer::MarkDirty()
+	{
+		Application::Get().RequestFrame();
+	}
+
 }
 
 namespace Swift
@@ -26,6 +57,7 @@ namespace Swift
 	void LayerStack::AddLayer(Layer* layer)
 	{
 		m_Layers.emplace(m_Layers.begin() + m_InsertIndex++, layer);
+		m_GraphDirty = true;
 
 		layer->OnAttach();
 	}
@@ -38,12 +70,14 @@ namespace Swift
 			layer->OnDetach();
 			m_Layers.erase(layerIndex);
 			m_InsertIndex--;
+			m_GraphDirty = true;
 		}
 	}
 
 	void LayerStack::AddOverlay(Layer* overlay)
 	{
 		m_Layers.emplace_back(overlay);
+		m_GraphDirty = true;
 
 		overlay->OnAttach();
 	}
@@ -55,7 +89,74 @@ namespace Swift
 		{
 			overlay->OnDetach();
 			m_Layers.erase(layerIndex);
+			m_GraphDirty = true;
+		}
+	}
+
+	void LayerStack::Update(float deltaTime)
+	{
+		if (m_GraphDirty)
+			BuildUpdateGraph();
+
+		for (auto& level : m_UpdateLevels)
+		{
+			if (level.size() == 1)
+			{
+				level[0]->OnUpdate(deltaTime);
+				continue;
+			}
+
+			m_Workers->Dispatch(level.size(), [&level, deltaTime](size_t index)
+			{
+				APP_PROFILE_SCOPE("Layer::OnUpdate");
+				level[index]->OnUpdate(deltaTime);
+			});
 		}
 	}
 
+	bool LayerStack::HasParallelLayers()
+	{
+		if (m_GraphDirty)
+			BuildUpdateGraph();
+
+		return m_HasParallelLayers;
+	}
+
+	void LayerStack::BuildUpdateGraph()
+	{
+		m_UpdateLevels.clear();
+		m_HasParallelLayers = false;
+
+		// Note(Jorben): A layer goes one level after the last layer before it that it conflicts with
+		std::vector<size_t> levels(m_Layers.size(), 0);
+		for (size_t i = 0; i < m_Layers.size(); i++)
+		{
+			const LayerDependencies& dependencies = m_Layers[i]->GetDependencies();
+			m_HasParallelLayers |= dependencies.Parallel;
+
+			for (size_t j = 0; j < i; j++)
+			{
+				if (dependencies.ConflictsWith(m_Layers[j]->GetDependencies()))
+					levels[i] = std::max(levels[i], levels[j] + 1);
+			}
+
+			if (levels[i] >= m_UpdateLevels.size())
+				m_UpdateLevels.resize(levels[i] + 1);
+
+			m_UpdateLevels[levels[i]].push_back(m_Layers[i]);
+		}
+
+		// Note(Jorben): The calling thread takes part in every dispatch, so the widest level needs one worker less than its size
+		size_t widest = 0;
+		for (auto& level : m_UpdateLevels)
+			widest = std::max(widest, level.size());
+
+		uint32_t hardwareThreads = std::max(std::thread::hardware_concurrency(), 2u);
+		uint32_t workers = (uint32_t)std::min(widest, (size_t)hardwareThreads) - 1;
+		if (workers > 0 && (!m_Workers || m_Workers->GetWorkerCount() != workers))
+			m_Workers = std::make_unique<Utils::ThreadPool>(workers);
+
+		m_GraphDirty = false;
+	}
+
 }
\ No newline at end of file
@@ -1,15 +1,21 @@
 #include "swpch.h"
 #include "Window.hpp"
 
-#include "Swift/Platforms/Windows/WindowsWindow.hpp"
+#if defined(APP_PLATFORM_WINDOWS)
+	#include "Swift/Platforms/Windows/WindowsWindow.hpp"
+#elif defined(APP_PLATFORM_LINUX)
+	#include "Swift/Platforms/Linux/LinuxWindow.hpp"
+#endif
 
 namespace Swift
 {
 
 	std::unique_ptr<Window> Window::Create(const WindowSpecification& properties)
 	{
-		#ifdef APP_PLATFORM_WINDOWS
+		#if defined(APP_PLATFORM_WINDOWS)
 		return std::make_unique<WindowsWindow>(properties);
+		#elif defined(APP_PLATFORM_LINUX)
+		return std::make_unique<LinuxWindow>(properties);
 		#endif
 
 		// TODO: Add all the platforms
@@ -59,6 +59,11 @@ namespace Swift
 		virtual void OnUpdate() = 0;
 		virtual void OnRender() = 0;
 
+		// Note(Jorben): Blocks until an event comes in, Wake() gets called or the timeout (in seconds) has passed.
+		virtual void WaitEvents(float timeout) = 0;
+		// Note(Jorben): Can be called from any thread.
+		virtual void Wake() = 0;
+
 		// Actual window size
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
@@ -69,6 +74,8 @@ namespace Swift
 		virtual uint32_t GetMonitorWidth() const = 0;
 		virtual uint32_t GetMonitorHeight() const = 0;
 
+		virtual bool IsFocused() const = 0;
+
 		// Extra
 		virtual void SetVSync(bool enabled) = 0;
 		virtual bool IsVSync() const = 0;
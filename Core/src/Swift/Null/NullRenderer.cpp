@@ -0,0 +1,166 @@
+#include "swpch.h"
+#include "NullRenderer.hpp"
+
+#include "Swift/Core/Logging.hpp"
+#include "Swift/Core/Application.hpp"
+#include "Swift/Utils/Profiler.hpp"
+
+#include "Swift/Renderer/Renderer.hpp"
+#include "Swift/Renderer/Buffers.hpp"
+
+#include "Swift/Null/NullResources.hpp"
+
+namespace Swift
+{
+
+	NullStats NullRenderer::s_Stats = {};
+
+	NullRenderer::NullRenderer()
+	{
+	}
+
+	NullRenderer::~NullRenderer()
+	{
+		m_SwapChainImages.clear();
+		m_DepthImage.reset();
+		m_ResourceFreeQueue.Execute();
+	}
+
+	void NullRenderer::Init()
+	{
+		auto& window = Application::Get().GetWindow();
+		CreateImages(window.GetWidth(), window.GetHeight());
+
+		APP_LOG_INFO("Using the null renderer, nothing will be displayed.");
+	}
+
+	void NullRenderer::BeginFrame()
+	{
+		if (Application::Get().IsMinimized())
+			return;
+
+		Renderer::GetCurrentRenderData().Reset();
+
+		s_Stats.Current.FreeFunctions += (uint32_t)m_ResourceFreeQueue.Size();
+		m_ResourceFreeQueue.Execute();
+	}
+
+	void NullRenderer::EndFrame()
+	{
+		if (Application::Get().IsMinimized())
+			return;
+
+		{
+			APP_PROFILE_SCOPE("RenderQueue");
+			s_Stats.Current.RenderFunctions += (uint32_t)m_RenderQueue.Size();
+			m_RenderQueue.Execute();
+		}
+
+		// Note(Jorben): Other threads can keep recording into Current, so verify a snapshot of the frame
+		NullFrameStats frame = {};
+		s_Stats.Current.MoveTo(frame);
+		VerifyStable(frame);
+
+		s_Stats.Previous = frame;
+		s_Stats.Frames++;
+
+		m_CurrentFrame = (m_CurrentFrame + 1) % (uint32_t)RendererSpecification::BufferCount;
+	}
+
+	void NullRenderer::Draw(const Ref<CommandBuffer>& commandBuffer, uint32_t verticeCount)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+		data.DrawCalls++;
+		data.Triangles += verticeCount / 3;
+		data.Instances++;
+
+		s_Stats.Current.DrawCalls++;
+		s_Stats.Current.Vertices += verticeCount;
+	}
+
+	void NullRenderer::DrawIndexed(const Ref<CommandBuffer>& commandBuffer, const Ref<IndexBuffer>& indexBuffer)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+		data.DrawCalls++;
+		data.Triangles += indexBuffer->GetCount() / 3;
+		data.Instances++;
+
+		s_Stats.Current.DrawCalls++;
+		s_Stats.Current.Vertices += indexBuffer->GetCount();
+	}
+
+	void NullRenderer::DrawBatch(const Ref<CommandBuffer>& commandBuffer, const Ref<Pipeline>& pipeline, std::span<const DrawCommand> commands)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+		data.DrawCalls += (uint32_t)commands.size();
+
+		uint32_t triangles = 0;
+		uint32_t instances = 0;
+
+		s_Stats.Current.DrawCalls += (uint32_t)commands.size();
+		for (const DrawCommand& command : commands)
+		{
+			s_Stats.Current.Vertices += (uint64_t)command.Count * command.InstanceCount;
+
+			triangles += (command.Count / 3) * command.InstanceCount;
+			instances += command.InstanceCount;
+		}
+
+		data.Triangles += triangles;
+		data.Instances += instances;
+	}
+
+	void NullRenderer::OnResize(uint32_t width, uint32_t height)
+	{
+		for (auto& image : m_SwapChainImages)
+			image->Resize(width, height);
+
+		m_DepthImage->Resize(width, height);
+	}
+
+	void NullRenderer::CreateImages(uint32_t width, uint32_t height)
+	{
+		constexpr const uint32_t framesInFlight = (uint32_t)RendererSpecification::BufferCount;
+
+		for (uint32_t i = 0; i < framesInFlight; i++)
+		{
+			ImageSpecification specs = {};
+			specs.Usage = ImageUsage::None;
+			specs.Format = ImageFormat::BGRA;
+			specs.Flags = ImageUsageFlags::Colour | ImageUsageFlags::NoMipMaps;
+			specs.Width = width;
+			specs.Height = height;
+			specs.Layout = ImageLayout::Presentation;
+
+			m_SwapChainImages.push_back(RefHelper::Create<NullImage2D>(specs));
+		}
+
+		ImageSpecification specs = {};
+		specs.Usage = ImageUsage::Size;
+		specs.Format = ImageFormat::Depth32SFloat;
+		specs.Flags = ImageUsageFlags::Depth | ImageUsageFlags::Sampled | ImageUsageFlags::NoMipMaps;
+		specs.Width = width;
+		specs.Height = height;
+		specs.Layout = ImageLayout::Depth;
+
+		m_DepthImage = RefHelper::Create<NullImage2D>(specs);
+	}
+
+	void NullRenderer::VerifyStable(const NullFrameStats& current)
+	{
+		if (!m_ExpectStable || s_Stats.Frames < m_WarmupFrames || current == s_Stats.Previous)
+			return;
+
+		const NullFrameStats& previous = s_Stats.Previous;
+
+		APP_LOG_ERROR("[NullRenderer] Frame {0} differs from the previous frame:", s_Stats.Frames);
+		APP_LOG_ERROR("    Allocations: {0} -> {1}, Frees: {2} -> {3}, Bytes: {4} -> {5}", previous.Allocations.load(), current.Allocations.load(), previous.Frees.load(), current.Frees.load(), previous.AllocatedBytes.load(), current.AllocatedBytes.load());
+		APP_LOG_ERROR("    DrawCalls: {0} -> {1}, Vertices: {2} -> {3}, Binds: {4} -> {5}", previous.DrawCalls.load(), current.DrawCalls.load(), previous.Vertices.load(), current.Vertices.load(), previous.Binds.load(), current.Binds.load());
+		APP_LOG_ERROR("    PushConstants: {0} -> {1}, Dispatches: {2} -> {3}, Submits: {4} -> {5}", previous.PushConstants.load(), current.PushConstants.load(), previous.Dispatches.load(), current.Dispatches.load(), previous.Submits.load(), current.Submits.load());
+		APP_LOG_ERROR("    Uploads: {0} -> {1}, UploadedBytes: {2} -> {3}", previous.Uploads.load(), current.Uploads.load(), previous.UploadedBytes.load(), current.UploadedBytes.load());
+		APP_LOG_ERROR("    RenderFunctions: {0} -> {1}, FreeFunctions: {2} -> {3}", previous.RenderFunctions.load(), current.RenderFunctions.load(), previous.FreeFunctions.load(), current.FreeFunctions.load());
+
+		APP_ASSERT(false, "The null renderer expected a stable frame.");
+	}
+
+}
\ No newline at end of file
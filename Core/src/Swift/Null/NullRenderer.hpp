@@ -0,0 +1,154 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "Swift/Core/Core.hpp"
+#include "Swift/Utils/Utils.hpp"
+
+#include "Swift/Renderer/RenderInstance.hpp"
+
+namespace Swift
+{
+
+	// Note(Jorben): Everything the null backend was asked to do in one frame.
+	// Every counter is atomic, since calls get recorded from the render thread, the main thread (resource creation)
+	// and the worker threads of layers that update in parallel.
+	struct NullFrameStats
+	{
+	public:
+		std::atomic<uint32_t> Allocations = 0; // Note(Jorben): Resources that were created
+		std::atomic<uint32_t> Frees = 0; // Note(Jorben): Resources that were destroyed
+		std::atomic<size_t> AllocatedBytes = 0;
+
+		std::atomic<uint32_t> DrawCalls = 0;
+		std::atomic<uint64_t> Vertices = 0; // Note(Jorben): Vertices or indices, times the instance count
+		std::atomic<uint32_t> Binds = 0;
+		std::atomic<uint32_t> PushConstants = 0;
+		std::atomic<uint32_t> Dispatches = 0;
+		std::atomic<uint32_t> Submits = 0;
+
+		std::atomic<uint32_t> Uploads = 0;
+		std::atomic<size_t> UploadedBytes = 0;
+
+		std::atomic<uint32_t> RenderFunctions = 0;
+		std::atomic<uint32_t> FreeFunctions = 0;
+
+	public:
+		NullFrameStats() = default;
+		NullFrameStats(const NullFrameStats& other) { *this = other; }
+
+		inline NullFrameStats& operator = (const NullFrameStats& other)
+		{
+			Allocations = other.Allocations.load();
+			Frees = other.Frees.load();
+			AllocatedBytes = other.AllocatedBytes.load();
+			DrawCalls = other.DrawCalls.load();
+			Vertices = other.Vertices.load();
+			Binds = other.Binds.load();
+			PushConstants = other.PushConstants.load();
+			Dispatches = other.Dispatches.load();
+			Submits = other.Submits.load();
+			Uploads = other.Uploads.load();
+			UploadedBytes = other.UploadedBytes.load();
+			RenderFunctions = other.RenderFunctions.load();
+			FreeFunctions = other.FreeFunctions.load();
+			return *this;
+		}
+
+		inline bool operator == (const NullFrameStats& other) const
+		{
+			return Allocations == other.Allocations && Frees == other.Frees && AllocatedBytes == other.AllocatedBytes &&
+				DrawCalls == other.DrawCalls && Vertices == other.Vertices && Binds == other.Binds && PushConstants == other.PushConstants &&
+				Dispatches == other.Dispatches && Submits == other.Submits && Uploads == other.Uploads && UploadedBytes == other.UploadedBytes &&
+				RenderFunctions == other.RenderFunctions && FreeFunctions == other.FreeFunctions;
+		}
+
+		// Note(Jorben): Moves the counters into other and starts at 0 again, without losing what gets recorded in between.
+		inline void MoveTo(NullFrameStats& other)
+		{
+			other.Allocations = Allocations.exchange(0);
+			other.Frees = Frees.exchange(0);
+			other.AllocatedBytes = AllocatedBytes.exchange(0);
+			other.DrawCalls = DrawCalls.exchange(0);
+			other.Vertices = Vertices.exchange(0);
+			other.Binds = Binds.exchange(0);
+			other.PushConstants = PushConstants.exchange(0);
+			other.Dispatches = Dispatches.exchange(0);
+			other.Submits = Submits.exchange(0);
+			other.Uploads = Uploads.exchange(0);
+			other.UploadedBytes = UploadedBytes.exchange(0);
+			other.RenderFunctions = RenderFunctions.exchange(0);
+			other.FreeFunctions = FreeFunctions.exchange(0);
+		}
+	};
+
+	struct NullStats
+	{
+	public:
+		NullFrameStats Current = {};
+		NullFrameStats Previous = {}; // Note(Jorben): Only written by EndFrame
+
+		uint64_t Frames = 0;
+		std::atomic<uint32_t> LiveResources = 0;
+	};
+
+	// Note(Jorben): Accepts every call without touching a GPU, so the CPU side of the engine can be measured on machines without Vulkan.
+	// Select it by defining APP_RENDERER_NULL, calls can be recorded from any thread.
+	class NullRenderer final : public RenderInstance
+	{
+	public:
+		NullRenderer();
+		virtual ~NullRenderer();
+
+		void Init() override;
+
+		void BeginFrame() override;
+		void EndFrame() override;
+
+		inline void Submit(RenderFunction function) override { m_RenderQueue.Add(function); }
+		inline void SubmitFree(FreeFunction function) override { m_ResourceFreeQueue.Add(function); }
+
+		inline void Wait() override {}
+
+		void Draw(const Ref<CommandBuffer>& commandBuffer, uint32_t verticeCount) override;
+		void DrawIndexed(const Ref<CommandBuffer>& commandBuffer, const Ref<IndexBuffer>& indexBuffer) override;
+		void DrawBatch(const Ref<CommandBuffer>& commandBuffer, const Ref<Pipeline>& pipeline, std::span<const DrawCommand> commands) override;
+
+		void OnResize(uint32_t width, uint32_t height) override;
+
+		inline Utils::Queue<RenderFunction>& GetRenderQueue() override { return m_RenderQueue; }
+		inline Utils::Queue<FreeFunction>& GetFreeQueue() override { return m_ResourceFreeQueue; }
+
+		inline uint32_t GetCurrentFrame() const override { return m_CurrentFrame; }
+		inline std::vector<Ref<Image2D>>& GetSwapChainImages() override { return m_SwapChainImages; }
+		inline Ref<Image2D> GetDepthImage() override { return m_DepthImage; }
+
+	public:
+		// Note(Jorben): After the warmup frames every frame has to make the exact same calls and allocations as the previous one, otherwise we assert.
+		// Useful to catch per frame allocations and call count regressions in a steady state scene.
+		inline void ExpectStable(bool enabled, uint32_t warmupFrames = 3) { m_ExpectStable = enabled; m_WarmupFrames = warmupFrames; }
+
+		inline static NullStats& GetStats() { return s_Stats; }
+
+	private:
+		void CreateImages(uint32_t width, uint32_t height);
+		void VerifyStable(const NullFrameStats& current);
+
+	private:
+		uint32_t m_CurrentFrame = 0;
+
+		std::vector<Ref<Image2D>> m_SwapChainImages = { };
+		Ref<Image2D> m_DepthImage = nullptr;
+
+		bool m_ExpectStable = false;
+		uint32_t m_WarmupFrames = 3;
+
+	private:
+		Utils::Queue<RenderFunction> m_RenderQueue = { };
+		Utils::Queue<FreeFunction> m_ResourceFreeQueue = { };
+
+		static NullStats s_Stats;
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,411 @@
+#include "swpch.h"
+#include "NullResources.hpp"
+
+#include "Swift/Core/Logging.hpp"
+
+#include "Swift/Renderer/Renderer.hpp"
+
+#include "Swift/Null/NullRenderer.hpp"
+
+namespace Swift
+{
+
+	static NullFrameStats& GetFrameStats()
+	{
+		return NullRenderer::GetStats().Current;
+	}
+
+	static void RecordBind()
+	{
+		GetFrameStats().Binds++;
+		Renderer::GetCurrentRenderData().Binds++;
+	}
+
+	static void RecordUpload(size_t size)
+	{
+		auto& stats = GetFrameStats();
+		stats.Uploads++;
+		stats.UploadedBytes += size;
+		Renderer::GetCurrentRenderData().UploadedBytes += size;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Resource
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	NullResource::NullResource(size_t size)
+	{
+		auto& stats = NullRenderer::GetStats();
+		stats.Current.Allocations++;
+		stats.Current.AllocatedBytes += size;
+		stats.LiveResources++;
+		Renderer::GetCurrentRenderData().Allocations++;
+	}
+
+	NullResource::~NullResource()
+	{
+		auto& stats = NullRenderer::GetStats();
+		stats.Current.Frees++;
+		stats.LiveResources--;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// CommandBuffer & RenderPass
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	NullCommandBuffer::NullCommandBuffer(CommandBufferSpecification specs)
+		: m_Specification(specs)
+	{
+	}
+
+	void NullCommandBuffer::Submit(Queue queue, const std::vector<Ref<CommandBuffer>>& waitOn)
+	{
+		GetFrameStats().Submits++;
+		Renderer::GetCurrentRenderData().Submits++;
+	}
+
+	NullRenderPass::NullRenderPass(RenderPassSpecification specs, Ref<CommandBuffer> commandBuffer)
+		: m_Specification(specs), m_CommandBuffer(commandBuffer)
+	{
+	}
+
+	void NullRenderPass::Begin()
+	{
+		m_CommandBuffer->Begin();
+	}
+
+	void NullRenderPass::End()
+	{
+		m_CommandBuffer->End();
+	}
+
+	void NullRenderPass::Submit(const std::vector<Ref<CommandBuffer>>& waitOn)
+	{
+		m_CommandBuffer->Submit(Queue::Graphics, waitOn);
+	}
+
+	void NullRenderPass::Resize(uint32_t width, uint32_t height)
+	{
+		for (auto& image : m_Specification.ColourAttachment)
+			image->Resize(width, height);
+
+		if (m_Specification.DepthAttachment)
+			m_Specification.DepthAttachment->Resize(width, height);
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Buffers
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	NullVertexBuffer::NullVertexBuffer(void* data, size_t size)
+		: NullResource(size)
+	{
+		RecordUpload(size);
+	}
+
+	void NullVertexBuffer::Bind(const Ref<CommandBuffer>& commandBuffer)
+	{
+		RecordBind();
+	}
+
+	NullIndexBuffer::NullIndexBuffer(uint32_t* indices, uint32_t count)
+		: NullResource(sizeof(uint32_t) * count), m_Count(count)
+	{
+		RecordUpload(sizeof(uint32_t) * count);
+	}
+
+	void NullIndexBuffer::Bind(const Ref<CommandBuffer>& commandBuffer) const
+	{
+		RecordBind();
+	}
+
+	NullUniformBuffer::NullUniformBuffer(size_t dataSize)
+		: NullResource(dataSize * (size_t)RendererSpecification::BufferCount)
+	{
+	}
+
+	void NullUniformBuffer::SetData(void* data, size_t size, size_t offset)
+	{
+		RecordUpload(size);
+	}
+
+	void NullUniformBuffer::Upload(const Ref<DescriptorSet>& set, Descriptor element)
+	{
+		GetFrameStats().Uploads++;
+	}
+
+	NullDynamicUniformBuffer::NullDynamicUniformBuffer(uint32_t elements, size_t sizeOfOneElement)
+		: NullResource(elements * sizeOfOneElement * (size_t)RendererSpecification::BufferCount), m_ElementCount(elements), m_SizeOfOneElement(sizeOfOneElement)
+	{
+	}
+
+	void NullDynamicUniformBuffer::SetData(void* data, size_t size)
+	{
+		RecordUpload(size);
+	}
+
+	void NullDynamicUniformBuffer::SetDataIndexed(uint32_t index, void* data, size_t size)
+	{
+		m_IndexedSizes.push_back(size);
+	}
+
+	void NullDynamicUniformBuffer::UploadIndexedData()
+	{
+		for (size_t size : m_IndexedSizes)
+			RecordUpload(size);
+
+		m_IndexedSizes.clear();
+	}
+
+	void NullDynamicUniformBuffer::Upload(const Ref<DescriptorSet>& set, Descriptor element)
+	{
+		GetFrameStats().Uploads++;
+	}
+
+	void NullDynamicUniformBuffer::Upload(const Ref<DescriptorSet>& set, Descriptor element, size_t offset)
+	{
+		GetFrameStats().Uploads++;
+	}
+
+	NullStorageBuffer::NullStorageBuffer(size_t dataSize)
+		: NullResource(dataSize), m_Data(dataSize)
+	{
+	}
+
+	void NullStorageBuffer::SetData(void* data, size_t size, size_t offset)
+	{
+		APP_ASSERT((offset + size <= m_Data.size()), "Tried to set data outside of the storage buffer.");
+
+		memcpy(m_Data.data() + offset, data, size);
+		RecordUpload(size);
+	}
+
+	void NullStorageBuffer::Upload(const Ref<DescriptorSet>& set, Descriptor element)
+	{
+		GetFrameStats().Uploads++;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Image
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	NullImage2D::NullImage2D(const ImageSpecification& specs)
+		: NullResource((size_t)specs.Width * specs.Height * 4), m_Specification(specs)
+	{
+	}
+
+	void NullImage2D::SetData(void* data, size_t size)
+	{
+		RecordUpload(size);
+	}
+
+	void NullImage2D::Resize(uint32_t width, uint32_t height)
+	{
+		m_Specification.Width = width;
+		m_Specification.Height = height;
+	}
+
+	void NullImage2D::Upload(const Ref<DescriptorSet>& set, Descriptor element)
+	{
+		GetFrameStats().Uploads++;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Shaders
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	std::vector<std::vector<char>> NullShaderCompiler::CompileBatch(const std::vector<ShaderCompileJob>& jobs, std::function<void(size_t index, const std::vector<char>& code)> onCompleted)
+	{
+		std::vector<std::vector<char>> results(jobs.size());
+
+		if (onCompleted)
+		{
+			for (size_t i = 0; i < results.size(); i++)
+				onCompleted(i, results[i]);
+		}
+
+		return results;
+	}
+
+	NullShader::NullShader(size_t size)
+		: NullResource(size)
+	{
+	}
+
+	NullComputeShader::NullComputeShader(size_t size)
+		: NullResource(size)
+	{
+	}
+
+	void NullComputeShader::Dispatch(const Ref<CommandBuffer>& commandBuffer, uint32_t width, uint32_t height, uint32_t depth)
+	{
+		GetFrameStats().Dispatches++;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Pipeline
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	NullPipeline::NullPipeline(PipelineSpecification specs, Ref<DescriptorSets> sets)
+		: m_Specification(specs), m_Sets(sets)
+	{
+	}
+
+	void NullPipeline::Use(const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint)
+	{
+		RecordBind();
+	}
+
+	void NullPipeline::SetCullingMode(const Ref<CommandBuffer>& commandBuffer, CullingMode mode)
+	{
+		m_Specification.Cullingmode = mode;
+	}
+
+	void NullPipeline::SetPolygonMode(const Ref<CommandBuffer>& commandBuffer, PolygonMode mode)
+	{
+		m_Specification.Polygonmode = mode;
+	}
+
+	void NullPipeline::SetDepthState(const Ref<CommandBuffer>& commandBuffer, bool test, bool write)
+	{
+		m_Specification.DepthTest = test;
+		m_Specification.DepthWrite = write;
+	}
+
+	void NullPipeline::SetBlending(const Ref<CommandBuffer>& commandBuffer, bool enabled)
+	{
+		m_Specification.Blending = enabled;
+	}
+
+	void NullPipeline::PushConstants(const Ref<CommandBuffer>& commandBuffer, const void* data, uint32_t size, uint32_t offset)
+	{
+		APP_ASSERT((offset + size <= m_Specification.PushConstantSize), "Push constant range exceeds the pipeline's PushConstantSize.");
+
+		GetFrameStats().PushConstants++;
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Descriptors
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	NullDescriptorSet::NullDescriptorSet(Descriptor::SetID setID)
+		: m_SetID(setID)
+	{
+	}
+
+	void NullDescriptorSet::Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint, const std::vector<uint32_t>& dynamicOffsets)
+	{
+		RecordBind();
+	}
+
+	NullDescriptorSets::NullDescriptorSets(const std::initializer_list<AmountGroup>& sets)
+	{
+		for (auto& layout : sets)
+		{
+			m_OriginalLayouts[layout.Layout.Set] = layout.Layout;
+			SetAmount(layout.Layout.Set, layout.Amount);
+		}
+	}
+
+	void NullDescriptorSets::SetAmount(Descriptor::SetID setID, uint32_t amount)
+	{
+		auto& sets = m_DescriptorSets[setID];
+
+		if (amount < (uint32_t)sets.size())
+			sets.resize((size_t)amount);
+
+		while (amount > (uint32_t)sets.size())
+			sets.push_back(RefHelper::Create<NullDescriptorSet>(setID));
+	}
+
+	uint32_t NullDescriptorSets::GetAmount(Descriptor::SetID setID) const
+	{
+		auto it = m_DescriptorSets.find(setID);
+		if (it == m_DescriptorSets.end())
+		{
+			APP_LOG_ERROR("Failed to find descriptor set by ID: {0}", setID);
+			return 0;
+		}
+
+		return (uint32_t)it->second.size();
+	}
+
+	DescriptorSetLayout& NullDescriptorSets::GetLayout(Descriptor::SetID setID)
+	{
+		auto it = m_OriginalLayouts.find(setID);
+		if (it == m_OriginalLayouts.end())
+		{
+			APP_LOG_ERROR("Failed to find descriptor set by ID: {0}", setID);
+		}
+
+		return it->second;
+	}
+
+	std::vector<Ref<DescriptorSet>>& NullDescriptorSets::GetSets(Descriptor::SetID setID)
+	{
+		auto it = m_DescriptorSets.find(setID);
+		if (it == m_DescriptorSets.end())
+		{
+			APP_LOG_ERROR("Failed to find descriptor set by ID: {0}", setID);
+		}
+
+		return it->second;
+	}
+
+	Ref<DescriptorSet> NullDescriptorSets::AllocateTransient(Descriptor::SetID setID)
+	{
+		if (m_OriginalLayouts.find(setID) == m_OriginalLayouts.end())
+		{
+			APP_LOG_ERROR("Failed to find descriptor set by ID: {0}", setID);
+			return nullptr;
+		}
+
+		return RefHelper::Create<NullDescriptorSet>(setID);
+	}
+
+	NullBindlessDescriptors::NullBindlessDescriptors(const BindlessSpecification& specs)
+		: m_Specification(specs)
+	{
+	}
+
+	uint32_t NullBindlessDescriptors::AddImage(const Ref<Image2D>& image)
+	{
+		if (!m_FreeImages.empty())
+		{
+			uint32_t index = m_FreeImages.back();
+			m_FreeImages.pop_back();
+			return index;
+		}
+
+		if (m_NextImage < m_Specification.MaxImages)
+			return m_NextImage++;
+
+		APP_LOG_ERROR("Exceeded the maximum amount of bindless images ({0}).", m_Specification.MaxImages);
+		return m_Specification.MaxImages;
+	}
+
+	uint32_t NullBindlessDescriptors::AddStorageBuffer(const Ref<StorageBuffer>& buffer)
+	{
+		if (!m_FreeStorageBuffers.empty())
+		{
+			uint32_t index = m_FreeStorageBuffers.back();
+			m_FreeStorageBuffers.pop_back();
+			return index;
+		}
+
+		if (m_NextStorageBuffer < m_Specification.MaxStorageBuffers)
+			return m_NextStorageBuffer++;
+
+		APP_LOG_ERROR("Exceeded the maximum amount of bindless storage buffers ({0}).", m_Specification.MaxStorageBuffers);
+		return m_Specification.MaxStorageBuffers;
+	}
+
+	void NullBindlessDescriptors::RemoveImage(uint32_t index)
+	{
+		m_FreeImages.push_back(index);
+	}
+
+	void NullBindlessDescriptors::RemoveStorageBuffer(uint32_t index)
+	{
+		m_FreeStorageBuffers.push_back(index);
+	}
+
+	void NullBindlessDescriptors::Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint)
+	{
+		RecordBind();
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,302 @@
+#pragma once
+
+#include <vector>
+
+#include "Swift/Core/Core.hpp"
+#include "Swift/Utils/Utils.hpp"
+
+#include "Swift/Renderer/Image.hpp"
+#include "Swift/Renderer/Shader.hpp"
+#include "Swift/Renderer/Buffers.hpp"
+#include "Swift/Renderer/Pipeline.hpp"
+#include "Swift/Renderer/RenderPass.hpp"
+#include "Swift/Renderer/Descriptors.hpp"
+#include "Swift/Renderer/CommandBuffer.hpp"
+
+namespace Swift
+{
+
+	// Note(Jorben): Every null resource derives from this, so creation and destruction end up in the NullStats.
+	class NullResource
+	{
+	public:
+		NullResource(size_t size = 0);
+		virtual ~NullResource();
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// CommandBuffer & RenderPass
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	class NullCommandBuffer final : public CommandBuffer, public NullResource
+	{
+	public:
+		NullCommandBuffer(CommandBufferSpecification specs);
+		virtual ~NullCommandBuffer() = default;
+
+		inline void Begin() override {}
+		inline void End() override {}
+		void Submit(Queue queue, const std::vector<Ref<CommandBuffer>>& waitOn) override;
+
+		inline void WaitOnFinish() override {}
+
+		inline void BeginTimer(const std::string& name) override {}
+		inline void EndTimer() override {}
+
+	private:
+		CommandBufferSpecification m_Specification = {};
+	};
+
+	class NullRenderPass final : public RenderPass, public NullResource
+	{
+	public:
+		NullRenderPass(RenderPassSpecification specs, Ref<CommandBuffer> commandBuffer);
+		virtual ~NullRenderPass() = default;
+
+		void Begin() override;
+		void End() override;
+		void Submit(const std::vector<Ref<CommandBuffer>>& waitOn) override;
+
+		void Resize(uint32_t width, uint32_t height) override;
+
+		inline RenderPassSpecification& GetSpecification() override { return m_Specification; }
+		inline Ref<CommandBuffer> GetCommandBuffer() override { return m_CommandBuffer; }
+
+	private:
+		RenderPassSpecification m_Specification = {};
+		Ref<CommandBuffer> m_CommandBuffer = nullptr;
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Buffers
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	class NullVertexBuffer final : public VertexBuffer, public NullResource
+	{
+	public:
+		NullVertexBuffer(void* data, size_t size);
+		virtual ~NullVertexBuffer() = default;
+
+		void Bind(const Ref<CommandBuffer>& commandBuffer) override;
+	};
+
+	class NullIndexBuffer final : public IndexBuffer, public NullResource
+	{
+	public:
+		NullIndexBuffer(uint32_t* indices, uint32_t count);
+		virtual ~NullIndexBuffer() = default;
+
+		void Bind(const Ref<CommandBuffer>& commandBuffer) const override;
+
+		inline uint32_t GetCount() const override { return m_Count; }
+
+	private:
+		uint32_t m_Count = 0;
+	};
+
+	class NullUniformBuffer final : public UniformBuffer, public NullResource
+	{
+	public:
+		NullUniformBuffer(size_t dataSize);
+		virtual ~NullUniformBuffer() = default;
+
+		void SetData(void* data, size_t size, size_t offset) override;
+
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element) override;
+	};
+
+	class NullDynamicUniformBuffer final : public DynamicUniformBuffer, public NullResource
+	{
+	public:
+		NullDynamicUniformBuffer(uint32_t elements, size_t sizeOfOneElement);
+		virtual ~NullDynamicUniformBuffer() = default;
+
+		void SetData(void* data, size_t size) override;
+
+		void SetDataIndexed(uint32_t index, void* data, size_t size) override;
+		void UploadIndexedData() override;
+
+		inline uint32_t GetAmountOfElements() const override { return m_ElementCount; }
+		inline size_t GetAlignment() const override { return m_SizeOfOneElement; }
+
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element) override;
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element, size_t offset) override;
+
+	private:
+		uint32_t m_ElementCount = 0;
+		size_t m_SizeOfOneElement = 0;
+
+		std::vector<size_t> m_IndexedSizes = { };
+	};
+
+	// Note(Jorben): Keeps a CPU copy of the data, so retrieval returns what was set.
+	class NullStorageBuffer final : public StorageBuffer, public NullResource
+	{
+	public:
+		NullStorageBuffer(size_t dataSize);
+		virtual ~NullStorageBuffer() = default;
+
+		void SetData(void* data, size_t size, size_t offset) override;
+
+		inline void* StartRetrieval() override { return m_Data.data(); }
+		inline void EndRetrieval() override {}
+
+		inline size_t GetSize() const override { return m_Data.size(); }
+
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element) override;
+
+	private:
+		std::vector<char> m_Data = { };
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Image
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Note(Jorben): Images created from a file are not loaded, so their size stays whatever the specification says.
+	class NullImage2D final : public Image2D, public NullResource
+	{
+	public:
+		NullImage2D(const ImageSpecification& specs);
+		virtual ~NullImage2D() = default;
+
+		void SetData(void* data, size_t size) override;
+
+		void Resize(uint32_t width, uint32_t height) override;
+
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element) override;
+		inline void Transition(ImageLayout initial, ImageLayout final) override { m_Specification.Layout = final; }
+
+		inline ImageSpecification& GetSpecification() override { return m_Specification; }
+
+		inline uint32_t GetWidth() const override { return m_Specification.Width; }
+		inline uint32_t GetHeight() const override { return m_Specification.Height; }
+
+	private:
+		ImageSpecification m_Specification = {};
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Shaders
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Note(Jorben): Doesn't compile anything, every shader comes out as empty code.
+	class NullShaderCompiler final : public ShaderCompiler
+	{
+	public:
+		NullShaderCompiler() = default;
+		virtual ~NullShaderCompiler() = default;
+
+		inline std::vector<char> Compile(const std::string& code, ShaderStage stage, const ShaderCompileOptions& options, const std::string& name) override { return { }; }
+		inline ShaderSpecification Compile(const std::string& fragment, const std::string& vertex) override { return {}; }
+
+		std::vector<std::vector<char>> CompileBatch(const std::vector<ShaderCompileJob>& jobs, std::function<void(size_t index, const std::vector<char>& code)> onCompleted) override;
+
+		inline std::vector<ShaderCompileReport> GetReports() override { return { }; }
+		inline void LogReports() override {}
+
+		inline std::string GetVersion() override { return "Null"; }
+	};
+
+	class NullShader final : public Shader, public NullResource
+	{
+	public:
+		NullShader(size_t size);
+		virtual ~NullShader() = default;
+	};
+
+	class NullComputeShader final : public ComputeShader, public NullResource
+	{
+	public:
+		NullComputeShader(size_t size);
+		virtual ~NullComputeShader() = default;
+
+		void Dispatch(const Ref<CommandBuffer>& commandBuffer, uint32_t width, uint32_t height, uint32_t depth) override;
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Pipeline
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	class NullPipeline final : public Pipeline, public NullResource
+	{
+	public:
+		NullPipeline(PipelineSpecification specs, Ref<DescriptorSets> sets);
+		virtual ~NullPipeline() = default;
+
+		void Use(const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint) override;
+
+		void SetCullingMode(const Ref<CommandBuffer>& commandBuffer, CullingMode mode) override;
+		void SetPolygonMode(const Ref<CommandBuffer>& commandBuffer, PolygonMode mode) override;
+		void SetDepthState(const Ref<CommandBuffer>& commandBuffer, bool test, bool write) override;
+		void SetBlending(const Ref<CommandBuffer>& commandBuffer, bool enabled) override;
+
+		void PushConstants(const Ref<CommandBuffer>& commandBuffer, const void* data, uint32_t size, uint32_t offset) override;
+
+		inline PipelineSpecification& GetSpecification() override { return m_Specification; };
+		inline const Ref<DescriptorSets>& GetDescriptorSets() override { return m_Sets; }
+
+	private:
+		PipelineSpecification m_Specification = {};
+		Ref<DescriptorSets> m_Sets = nullptr;
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Descriptors
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	class NullDescriptorSet final : public DescriptorSet, public NullResource
+	{
+	public:
+		NullDescriptorSet(Descriptor::SetID setID);
+		virtual ~NullDescriptorSet() = default;
+
+		void Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint, const std::vector<uint32_t>& dynamicOffsets) override;
+		inline void Flush() override {}
+
+		inline Descriptor::SetID GetSetID() const { return m_SetID; }
+
+	private:
+		Descriptor::SetID m_SetID = 0;
+	};
+
+	class NullDescriptorSets final : public DescriptorSets, public NullResource
+	{
+	public:
+		NullDescriptorSets(const std::initializer_list<AmountGroup>& sets);
+		virtual ~NullDescriptorSets() = default;
+
+		void SetAmount(Descriptor::SetID setID, uint32_t amount) override;
+		uint32_t GetAmount(Descriptor::SetID setID) const override;
+
+		DescriptorSetLayout& GetLayout(Descriptor::SetID setID) override;
+		std::vector<Ref<DescriptorSet>>& GetSets(Descriptor::SetID setID) override;
+
+		Ref<DescriptorSet> AllocateTransient(Descriptor::SetID setID) override;
+
+	private:
+		Dict<Descriptor::SetID, DescriptorSetLayout> m_OriginalLayouts = { };
+		Dict<Descriptor::SetID, std::vector<Ref<DescriptorSet>>> m_DescriptorSets = { };
+	};
+
+	class NullBindlessDescriptors final : public BindlessDescriptors, public NullResource
+	{
+	public:
+		NullBindlessDescriptors(const BindlessSpecification& specs);
+		virtual ~NullBindlessDescriptors() = default;
+
+		uint32_t AddImage(const Ref<Image2D>& image) override;
+		uint32_t AddStorageBuffer(const Ref<StorageBuffer>& buffer) override;
+
+		void RemoveImage(uint32_t index) override;
+		void RemoveStorageBuffer(uint32_t index) override;
+
+		void Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint) override;
+
+		inline const BindlessSpecification& GetSpecification() const override { return m_Specification; }
+
+	private:
+		BindlessSpecification m_Specification = {};
+
+		// Note(Jorben): Only the indices matter, freed indices get reused right away since there is no GPU that could still read them.
+		std::vector<uint32_t> m_FreeImages = { };
+		std::vector<uint32_t> m_FreeStorageBuffers = { };
+		uint32_t m_NextImage = 0;
+		uint32_t m_NextStorageBuffer = 0;
+	};
+
+}
\ No newline at end of file
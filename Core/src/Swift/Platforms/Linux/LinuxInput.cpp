@@ -0,0 +1,51 @@
+#include "swpch.h"
+#include "LinuxInput.hpp"
+
+#include <GLFW/glfw3.h>
+
+#include "Swift/Core/Application.hpp"
+
+namespace Swift
+{
+
+    bool LinuxInput::IsKeyPressedImplementation(Key keycode)
+    {
+        GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+
+        int state = glfwGetKey(window, (int)keycode);
+        return state == GLFW_PRESS || state == GLFW_REPEAT;
+    }
+
+    bool LinuxInput::IsMousePressedImplementation(MouseButton button)
+    {
+        GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+
+        int state = glfwGetMouseButton(window, (int)button);
+        return state == GLFW_PRESS;
+    }
+
+    glm::vec2 LinuxInput::GetMousePositionImplementation()
+    {
+        GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+
+        double xPos, yPos;
+        glfwGetCursorPos(window, &xPos, &yPos);
+
+        return { xPos, yPos };
+    }
+
+    void LinuxInput::SetCursorPositionImplementation(glm::vec2 position)
+    {
+        GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+
+        glfwSetCursorPos(window, position.x, position.y);
+    }
+
+    void LinuxInput::SetCursorModeImplementation(CursorMode mode)
+    {
+        GLFWwindow* window = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+
+        glfwSetInputMode(window, GLFW_CURSOR, (int)mode);
+    }
+
+}
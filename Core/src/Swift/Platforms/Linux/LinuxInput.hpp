@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Swift/Core/Input/Input.hpp"
+
+namespace Swift
+{
+
+	class LinuxInput : public Input
+	{
+	public:
+		LinuxInput() = default;
+		virtual ~LinuxInput() = default;
+
+		bool IsKeyPressedImplementation(Key keycode) override;
+		bool IsMousePressedImplementation(MouseButton button) override;
+
+		glm::vec2 GetMousePositionImplementation() override;
+
+		void SetCursorPositionImplementation(glm::vec2 position) override;
+		void SetCursorModeImplementation(CursorMode mode) override;
+	};
+
+}
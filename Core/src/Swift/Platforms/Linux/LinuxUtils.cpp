@@ -0,0 +1,107 @@
+#include "swpch.h"
+#include "LinuxUtils.hpp"
+
+#include "Swift/Core/Logging.hpp"
+
+#include <time.h>
+#include <stdio.h>
+
+namespace Swift::Utils
+{
+
+	std::unique_ptr<ToolKit> ToolKit::s_Instance = std::make_unique<LinuxToolKit>();
+
+	// Note(Jorben): There is no native file dialog on Linux, so we use zenity (which most desktops ship with).
+	static std::string RunDialog(const std::string& command)
+	{
+		FILE* pipe = popen(command.c_str(), "r");
+		if (!pipe)
+		{
+			APP_LOG_WARN("Failed to open a file dialog, make sure zenity is installed.");
+			return std::string();
+		}
+
+		std::string result = {};
+		char buffer[512] = { 0 };
+		while (fgets(buffer, sizeof(buffer), pipe))
+			result += buffer;
+
+		pclose(pipe);
+
+		if (!result.empty() && result.back() == '\n')
+			result.pop_back();
+
+		return result;
+	}
+
+	// Note(Jorben): Wraps the argument in single quotes, so paths & filters can't break out of the shell command.
+	static std::string QuoteArgument(const std::string& argument)
+	{
+		std::string result = "'";
+		for (char c : argument)
+		{
+			if (c == '\'')
+				result += "'\\''";
+			else
+				result += c;
+		}
+		result += "'";
+
+		return result;
+	}
+
+	// Note(Jorben): Converts a Windows style filter ("Name\0*.ext;*.ext2\0") to a zenity filter.
+	static std::string GetDialogFilter(const std::string& filter)
+	{
+		if (filter.empty())
+			return std::string();
+
+		std::string name = filter.c_str();
+		std::string patterns = (filter.size() > name.size() + 1) ? std::string(filter.c_str() + name.size() + 1) : name;
+		ToolKit::Replace(patterns, ';', ' ');
+
+		return " --file-filter=" + QuoteArgument(name + " | " + patterns);
+	}
+
+	static std::string GetDialogDirectory(const std::string& dir)
+	{
+		if (dir.empty())
+			return std::string();
+
+		return " --filename=" + QuoteArgument(dir + "/");
+	}
+
+	LinuxToolKit::LinuxToolKit()
+		: m_Start(GetTimeNanosecondsImpl())
+	{
+	}
+
+	std::string LinuxToolKit::OpenFileImpl(const std::string& filter, const std::string& dir) const
+	{
+		return RunDialog("zenity --file-selection" + GetDialogDirectory(dir) + GetDialogFilter(filter) + " 2>/dev/null");
+	}
+
+	std::string LinuxToolKit::SaveFileImpl(const std::string& filter, const std::string& dir) const
+	{
+		return RunDialog("zenity --file-selection --save --confirm-overwrite" + GetDialogDirectory(dir) + GetDialogFilter(filter) + " 2>/dev/null");
+	}
+
+	std::string LinuxToolKit::OpenDirectoryImpl(const std::string& dir) const
+	{
+		return RunDialog("zenity --file-selection --directory" + GetDialogDirectory(dir) + " 2>/dev/null");
+	}
+
+	double LinuxToolKit::GetTimeImpl() const
+	{
+		return (double)(GetTimeNanosecondsImpl() - m_Start) * 1e-9;
+	}
+
+	uint64_t LinuxToolKit::GetTimeNanosecondsImpl() const
+	{
+		timespec time = {};
+		clock_gettime(CLOCK_MONOTONIC, &time);
+
+		return (uint64_t)time.tv_sec * 1000000000ull + (uint64_t)time.tv_nsec;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Swift/Utils/Utils.hpp"
+
+namespace Swift::Utils
+{
+	
+	class LinuxToolKit : public ToolKit
+	{
+	public:
+		LinuxToolKit();
+
+	private:
+		std::string OpenFileImpl(const std::string& filter, const std::string& dir) const override;
+		std::string SaveFileImpl(const std::string& filter, const std::string& dir) const override;
+
+		std::string OpenDirectoryImpl(const std::string& dir) const override;
+
+		double GetTimeImpl() const override;
+		uint64_t GetTimeNanosecondsImpl() const override;
+
+	private:
+		uint64_t m_Start = 0; // Note(Jorben): GetTime() is relative to this, so the double keeps nanosecond precision
+	};
+
+}
\ No newline at end of file
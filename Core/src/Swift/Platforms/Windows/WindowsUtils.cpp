@@ -16,6 +16,11 @@ namespace Swift::Utils
 {
 
 	std::unique_ptr<ToolKit> ToolKit::s_Instance = std::make_unique<WindowsToolKit>();
+
+	WindowsToolKit::WindowsToolKit()
+		: m_Start(GetTimeNanosecondsImpl())
+	{
+	}
 	
 	std::string WindowsToolKit::OpenFileImpl(const std::string& filter, const std::string& dir) const
 	{
@@ -143,7 +148,22 @@ namespace Swift::Utils
 
 	double WindowsToolKit::GetTimeImpl() const
 	{
-		return glfwGetTime();
+		return (double)(GetTimeNanosecondsImpl() - m_Start) * 1e-9;
+	}
+
+	uint64_t WindowsToolKit::GetTimeNanosecondsImpl() const
+	{
+		// Note(Jorben): Not using GLFW's timer, since it only works after glfwInit which doesn't happen in headless mode
+		LARGE_INTEGER counter = {};
+		LARGE_INTEGER counterFrequency = {};
+		QueryPerformanceCounter(&counter);
+		QueryPerformanceFrequency(&counterFrequency);
+
+		uint64_t value = (uint64_t)counter.QuadPart;
+		uint64_t frequency = (uint64_t)counterFrequency.QuadPart;
+
+		// Note(Jorben): Split up to not overflow when multiplying the raw value
+		return (value / frequency) * 1000000000ull + ((value % frequency) * 1000000000ull) / frequency;
 	}
 
 }
\ No newline at end of file
@@ -8,7 +8,7 @@ namespace Swift::Utils
 	class WindowsToolKit : public ToolKit
 	{
 	public:
-		WindowsToolKit() = default;
+		WindowsToolKit();
 
 	private:
 		std::string OpenFileImpl(const std::string& filter, const std::string& dir) const override;
@@ -17,6 +17,10 @@ namespace Swift::Utils
 		std::string OpenDirectoryImpl(const std::string& dir) const override;
 
 		double GetTimeImpl() const override;
+		uint64_t GetTimeNanosecondsImpl() const override;
+
+	private:
+		uint64_t m_Start = 0; // Note(Jorben): GetTime() is relative to this, so the double keeps nanosecond precision
 	};
 
 }
\ No newline at end of file
@@ -153,6 +153,17 @@ namespace Swift
 		APP_MARK_FRAME;
 	}
 
+	void WindowsWindow::WaitEvents(float timeout)
+	{
+		APP_PROFILE_SCOPE("WaitEvents");
+		glfwWaitEventsTimeout((double)timeout);
+	}
+
+	void WindowsWindow::Wake()
+	{
+		glfwPostEmptyEvent();
+	}
+
 	uint32_t WindowsWindow::GetPositionX() const
 	{
 		int xPos = 0, yPos = 0;
@@ -181,6 +192,11 @@ namespace Swift
 		return mode->width;
 	}
 
+	bool WindowsWindow::IsFocused() const
+	{
+		return glfwGetWindowAttrib(m_Window, GLFW_FOCUSED) == GLFW_TRUE;
+	}
+
 	void WindowsWindow::SetVSync(bool enabled)
 	{
 		m_Data.VSync = enabled;
@@ -204,6 +220,7 @@ namespace Swift
 		switch (RendererSpecification::API)
 		{
 		case RendererSpecification::RenderingAPI::Vulkan:
+		case RendererSpecification::RenderingAPI::None:
 			glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
 			break;
 
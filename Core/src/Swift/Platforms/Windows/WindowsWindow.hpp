@@ -18,6 +18,9 @@ namespace Swift
 		void OnUpdate() override;
 		void OnRender() override;
 
+		void WaitEvents(float timeout) override;
+		void Wake() override;
+
 		uint32_t GetWidth() const override { return m_Data.Width; }
 		uint32_t GetHeight() const override { return m_Data.Height; }
 
@@ -27,6 +30,8 @@ namespace Swift
 		uint32_t GetMonitorWidth() const override;
 		uint32_t GetMonitorHeight() const override;
 
+		bool IsFocused() const override;
+
 		void SetVSync(bool enabled) override;
 		bool IsVSync() const override { return m_Data.VSync; }
 
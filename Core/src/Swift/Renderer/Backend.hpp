@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Swift/Core/Core.hpp"
+
+#include "Swift/Renderer/RendererConfig.hpp"
+#include "Swift/Renderer/RenderInstance.hpp"
+#include "Swift/Renderer/CommandBuffer.hpp"
+#include "Swift/Renderer/Pipeline.hpp"
+#include "Swift/Renderer/Buffers.hpp"
+#include "Swift/Renderer/Descriptors.hpp"
+#include "Swift/Renderer/Image.hpp"
+
+// Note(Jorben): Define APP_RENDERER_VIRTUAL to go through the abstract interfaces instead of calling into the backend directly.
+#if !defined(APP_RENDERER_VIRTUAL)
+	// Note(Jorben): The null renderer build doesn't have the Vulkan sources & headers available
+	#if !defined(APP_RENDERER_NULL)
+		#include "Swift/Vulkan/VulkanRenderer.hpp"
+		#include "Swift/Vulkan/VulkanCommandBuffer.hpp"
+		#include "Swift/Vulkan/VulkanPipeline.hpp"
+		#include "Swift/Vulkan/VulkanBuffers.hpp"
+		#include "Swift/Vulkan/VulkanDescriptors.hpp"
+		#include "Swift/Vulkan/VulkanImage.hpp"
+	#endif
+
+	#include "Swift/Null/NullRenderer.hpp"
+	#include "Swift/Null/NullResources.hpp"
+#endif
+
+namespace Swift
+{
+
+	// Note(Jorben): Maps the abstract interfaces to the classes of the API that is compiled in.
+	// Since those classes are final, calls made through these types are bound statically instead of through the vtable.
+	// This only covers the core itself (Renderer's forwarders & DrawQueue::Record), calls that user code makes through
+	// the abstract Refs (vertexBuffer->Bind(), pipeline->Use(), set->Bind(), ...) are still virtual and Renderer::Draw
+	// is still an out-of-line call into the backend. Routing those through here would mean exposing backend typed handles
+	// in the public headers. // TODO: Do that?
+	// Only include this in source files, it pulls in the backend headers.
+	template<RendererSpecification::RenderingAPI API>
+	struct BackendTypes
+	{
+	public:
+		using RenderInstanceType = RenderInstance;
+		using CommandBufferType = CommandBuffer;
+		using PipelineType = Pipeline;
+		using VertexBufferType = VertexBuffer;
+		using IndexBufferType = IndexBuffer;
+		using DescriptorSetType = DescriptorSet;
+		using Image2DType = Image2D;
+	};
+
+	#if !defined(APP_RENDERER_VIRTUAL) && !defined(APP_RENDERER_NULL)
+	template<>
+	struct BackendTypes<RendererSpecification::RenderingAPI::Vulkan>
+	{
+	public:
+		using RenderInstanceType = VulkanRenderer;
+		using CommandBufferType = VulkanCommandBuffer;
+		using PipelineType = VulkanPipeline;
+		using VertexBufferType = VulkanVertexBuffer;
+		using IndexBufferType = VulkanIndexBuffer;
+		using DescriptorSetType = VulkanDescriptorSet;
+		using Image2DType = VulkanImage2D;
+	};
+	#endif
+
+	#if !defined(APP_RENDERER_VIRTUAL)
+	template<>
+	struct BackendTypes<RendererSpecification::RenderingAPI::None>
+	{
+	public:
+		using RenderInstanceType = NullRenderer;
+		using CommandBufferType = NullCommandBuffer;
+		using PipelineType = NullPipeline;
+		using VertexBufferType = NullVertexBuffer;
+		using IndexBufferType = NullIndexBuffer;
+		using DescriptorSetType = NullDescriptorSet;
+		using Image2DType = NullImage2D;
+	};
+	#endif
+
+	using Backend = BackendTypes<RendererSpecification::API>;
+
+}
\ No newline at end of file
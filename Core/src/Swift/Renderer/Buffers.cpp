@@ -6,7 +6,11 @@
 #include "Swift/Renderer/Renderer.hpp"
 #include "Swift/Renderer/Descriptors.hpp"
 
+#if !defined(APP_RENDERER_NULL)
 #include "Swift/Vulkan/VulkanBuffers.hpp"
+#endif
+
+#include "Swift/Null/NullResources.hpp"
 
 namespace Swift
 {
@@ -86,8 +90,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanVertexBuffer>(data, size);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullVertexBuffer>(data, size);
 
 		default:
 			APP_LOG_ERROR("Invalid API selected.");
@@ -101,8 +110,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanIndexBuffer>(indices, count);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullIndexBuffer>(indices, count);
 
 		default:
 			APP_LOG_ERROR("Invalid API selected.");
@@ -116,8 +130,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanUniformBuffer>(dataSize);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullUniformBuffer>(dataSize);
 
 		default:
 			APP_LOG_ERROR("Invalid API selected.");
@@ -131,8 +150,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanDynamicUniformBuffer>(elements, sizeOfOneElement);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullDynamicUniformBuffer>(elements, sizeOfOneElement);
 
 		default:
 			APP_LOG_ERROR("Invalid API selected.");
@@ -146,8 +170,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanStorageBuffer>(dataSize);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullStorageBuffer>(dataSize);
 
 		default:
 			APP_LOG_ERROR("Invalid API selected.");
@@ -67,7 +67,7 @@ namespace Swift
 		VertexBuffer() = default;
 		virtual ~VertexBuffer() = default;
 
-		virtual void Bind(Ref<CommandBuffer> commandBuffer) = 0;
+		virtual void Bind(const Ref<CommandBuffer>& commandBuffer) = 0;
 
 		static Ref<VertexBuffer> Create(void* data, size_t size);
 	};
@@ -78,7 +78,7 @@ namespace Swift
 		IndexBuffer() = default;
 		virtual ~IndexBuffer() = default;
 
-		virtual void Bind(Ref<CommandBuffer> commandBuffer) const = 0;
+		virtual void Bind(const Ref<CommandBuffer>& commandBuffer) const = 0;
 
 		virtual uint32_t GetCount() const = 0;
 
@@ -94,7 +94,7 @@ namespace Swift
 
 		virtual void SetData(void* data, size_t size, size_t offset = 0) = 0;
 
-		virtual void Upload(Ref<DescriptorSet> set, Descriptor element) = 0;
+		virtual void Upload(const Ref<DescriptorSet>& set, Descriptor element) = 0;
 
 		static Ref<UniformBuffer> Create(size_t dataSize);
 	};
@@ -113,8 +113,8 @@ namespace Swift
 		virtual uint32_t GetAmountOfElements() const = 0;
 		virtual size_t GetAlignment() const = 0;
 
-		virtual void Upload(Ref<DescriptorSet> set, Descriptor element) = 0;
-		virtual void Upload(Ref<DescriptorSet> set, Descriptor element, size_t offset) = 0;
+		virtual void Upload(const Ref<DescriptorSet>& set, Descriptor element) = 0;
+		virtual void Upload(const Ref<DescriptorSet>& set, Descriptor element, size_t offset) = 0;
 
 		static Ref<DynamicUniformBuffer> Create(uint32_t elements, size_t sizeOfOneElement);
 	};
@@ -132,7 +132,7 @@ namespace Swift
 
 		virtual size_t GetSize() const = 0;
 
-		virtual void Upload(Ref<DescriptorSet> set, Descriptor element) = 0;
+		virtual void Upload(const Ref<DescriptorSet>& set, Descriptor element) = 0;
 
 		static Ref<StorageBuffer> Create(size_t dataSize);
 	};
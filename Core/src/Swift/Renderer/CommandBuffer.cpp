@@ -5,7 +5,11 @@
 
 #include "Swift/Renderer/Renderer.hpp"
 
+#if !defined(APP_RENDERER_NULL)
 #include "Swift/Vulkan/VulkanCommandBuffer.hpp"
+#endif
+
+#include "Swift/Null/NullResources.hpp"
 
 namespace Swift
 {
@@ -14,8 +18,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanCommandBuffer>(specs);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullCommandBuffer>(specs);
 
 		default:
 			APP_ASSERT(false, "Invalid API selected.");
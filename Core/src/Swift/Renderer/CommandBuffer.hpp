@@ -1,5 +1,8 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include "Swift/Core/Core.hpp"
 #include "Swift/Utils/Utils.hpp"
 
@@ -41,6 +44,10 @@ namespace Swift
 
 		virtual void WaitOnFinish() = 0;
 
+		// Note(Jorben): Measures the GPU time of everything recorded in between, the result ends up in Renderer::GetRenderData().GPUTimings
+		virtual void BeginTimer(const std::string& name) = 0;
+		virtual void EndTimer() = 0;
+
 		static Ref<CommandBuffer> Create(CommandBufferSpecification specs = {});
 	};
 
@@ -5,7 +5,11 @@
 
 #include "Swift/Renderer/Renderer.hpp"
 
+#if !defined(APP_RENDERER_NULL)
 #include "Swift/Vulkan/VulkanDescriptors.hpp"
+#endif
+
+#include "Swift/Null/NullResources.hpp"
 
 namespace Swift
 {
@@ -79,8 +83,33 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanDescriptorSets>(sets);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullDescriptorSets>(sets);
+
+		default:
+			APP_ASSERT(false, "Invalid API selected.");
+			break;
+		}
+
+		return nullptr;
+	}
+
+	Ref<BindlessDescriptors> BindlessDescriptors::Create(const BindlessSpecification& specs)
+	{
+		switch (RendererSpecification::API)
+		{
+		#if !defined(APP_RENDERER_NULL)
+		case RendererSpecification::RenderingAPI::Vulkan:
+			return RefHelper::Create<VulkanBindlessDescriptors>(specs);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullBindlessDescriptors>(specs);
 
 		default:
 			APP_ASSERT(false, "Invalid API selected.");
@@ -90,4 +119,4 @@ namespace Swift
 		return nullptr;
 	}
 
-}
+}
\ No newline at end of file
@@ -15,6 +15,8 @@ namespace Swift
 
 	class Pipeline;
 	class CommandBuffer;
+	class Image2D;
+	class StorageBuffer;
 
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	// Specifications 
@@ -64,6 +66,17 @@ namespace Swift
 		uint32_t AmountOf(DescriptorType type) const;
 	};
 
+	// Note(Jorben): Layout of the bindless set:
+	// binding 0: texture2D Images[MaxImages], binding 1: sampler Samplers[MaxImages] (same index as the image), binding 2: buffer StorageBuffers[MaxStorageBuffers]
+	struct BindlessSpecification
+	{
+	public:
+		Descriptor::SetID Set = 0;
+
+		uint32_t MaxImages = 4096;
+		uint32_t MaxStorageBuffers = 1024;
+	};
+
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	// Classes 
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -74,7 +87,10 @@ namespace Swift
 		DescriptorSet() = default;
 		virtual ~DescriptorSet() = default;
 	
-		virtual void Bind(Ref<Pipeline> pipeline, Ref<CommandBuffer> commandBuffer, PipelineBindPoint bindPoint = PipelineBindPoint::Graphics, const std::vector<uint32_t>& dynamicOffsets = { }) = 0;
+		// Note(Jorben): Uploads to the set are batched, the current frame's writes get submitted on Bind().
+		virtual void Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint = PipelineBindPoint::Graphics, const std::vector<uint32_t>& dynamicOffsets = { }) = 0;
+		// Note(Jorben): Submits the pending writes of every frame, only needed if the set isn't bound through Bind().
+		virtual void Flush() = 0;
 	};
 
 	class DescriptorSets
@@ -95,13 +111,40 @@ namespace Swift
 		DescriptorSets() = default;
 		virtual ~DescriptorSets() = default;
 
+		// Note(Jorben): Existing sets are kept (including their contents), only the difference gets allocated/released.
 		virtual void SetAmount(Descriptor::SetID setID, uint32_t amount) = 0;
 		virtual uint32_t GetAmount(Descriptor::SetID setID) const = 0;
 
 		virtual DescriptorSetLayout& GetLayout(Descriptor::SetID setID) = 0;
 		virtual std::vector<Ref<DescriptorSet>>& GetSets(Descriptor::SetID setID) = 0;
 
+		// Note(Jorben): A transient set is only valid for the current frame, it doesn't have to be freed.
+		virtual Ref<DescriptorSet> AllocateTransient(Descriptor::SetID setID) = 0;
+
 		static Ref<DescriptorSets> Create(const std::initializer_list<AmountGroup>& sets);
 	};
 
+	// Note(Jorben): One global set of (partially bound) resource arrays, resources are referenced in shaders by the index returned from Add*().
+	// Requires descriptor indexing support, the set only has to be bound once per frame and can be updated while in use.
+	class BindlessDescriptors
+	{
+	public:
+		BindlessDescriptors() = default;
+		virtual ~BindlessDescriptors() = default;
+
+		// Note(Jorben): Returns the index to use in the shader, on failure the maximum (from the specification) is returned.
+		virtual uint32_t AddImage(const Ref<Image2D>& image) = 0;
+		virtual uint32_t AddStorageBuffer(const Ref<StorageBuffer>& buffer) = 0;
+
+		// Note(Jorben): The index is only reused after all frames in flight that could be using it are finished.
+		virtual void RemoveImage(uint32_t index) = 0;
+		virtual void RemoveStorageBuffer(uint32_t index) = 0;
+
+		virtual void Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint = PipelineBindPoint::Graphics) = 0;
+
+		virtual const BindlessSpecification& GetSpecification() const = 0;
+
+		static Ref<BindlessDescriptors> Create(const BindlessSpecification& specs = {});
+	};
+
 }
\ No newline at end of file
@@ -0,0 +1,170 @@
+#include "swpch.h"
+#include "DrawQueue.hpp"
+
+#include "Swift/Core/Logging.hpp"
+#include "Swift/Utils/Profiler.hpp"
+
+#include "Swift/Renderer/Renderer.hpp"
+#include "Swift/Renderer/Backend.hpp"
+
+namespace Swift
+{
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Specifications
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	uint64_t SortKey::Opaque(uint8_t pass, uint16_t pipeline, uint16_t material, float depth)
+	{
+		return ((uint64_t)pass << 56) | ((uint64_t)pipeline << 40) | ((uint64_t)material << 24) | QuantizeDepth(depth);
+	}
+
+	uint64_t SortKey::Transparent(uint8_t pass, float depth, uint16_t pipeline, uint16_t material)
+	{
+		uint64_t invertedDepth = 0xFFFFFF - QuantizeDepth(depth);
+		return ((uint64_t)pass << 56) | (invertedDepth << 32) | ((uint64_t)pipeline << 16) | (uint64_t)material;
+	}
+
+	uint64_t SortKey::QuantizeDepth(float depth)
+	{
+		return (uint64_t)(std::clamp(depth, 0.0f, 1.0f) * (float)0xFFFFFF);
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// DrawQueue
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	void DrawQueue::Submit(uint64_t key, const DrawPacket& packet)
+	{
+		m_Passes[SortKey::GetPass(key)].push_back({ key, (uint32_t)m_Packets.size() });
+		m_Packets.push_back(packet);
+
+		m_Sorted = false;
+	}
+
+	void DrawQueue::Sort()
+	{
+		APP_PROFILE_SCOPE("DrawQueue::Sort");
+
+		if (m_Sorted)
+			return;
+
+		// Note(Jorben): Small passes aren't worth a thread
+		constexpr const size_t parallelThreshold = 4096;
+
+		std::vector<std::future<void>> futures = { };
+		for (size_t i = 0; i < m_Passes.size(); i++)
+		{
+			if (m_Passes[i].size() < 2)
+				continue;
+
+			if (m_Passes[i].size() < parallelThreshold)
+				RadixSort(m_Passes[i], m_Scratch[i]);
+			else
+				futures.emplace_back(std::async(std::launch::async, [this, i]() { RadixSort(m_Passes[i], m_Scratch[i]); }));
+		}
+
+		for (auto& future : futures)
+			future.get();
+
+		m_Sorted = true;
+	}
+
+	void DrawQueue::Record(uint8_t pass, const Ref<CommandBuffer>& commandBuffer)
+	{
+		APP_PROFILE_SCOPE("DrawQueue::Record");
+
+		if (!m_Sorted)
+			Sort();
+
+		Backend::PipelineType* currentPipeline = nullptr;
+		std::vector<uint32_t> dynamicOffset(1);
+
+		for (const Entry& entry : m_Passes[pass])
+		{
+			const DrawPacket& packet = m_Packets[entry.Packet];
+			auto pipeline = RefHelper::RawAs<Backend::PipelineType>(packet.GraphicsPipeline);
+
+			// Note(Jorben): Use() resets the pipeline's state, so we only call it when the pipeline actually changes
+			if (pipeline != currentPipeline)
+			{
+				pipeline->Use(commandBuffer, PipelineBindPoint::Graphics);
+				currentPipeline = pipeline;
+			}
+
+			for (size_t i = 0; i < DrawPacket::s_MaxDescriptorSets; i++)
+			{
+				if (!packet.Sets[i])
+					continue;
+
+				auto set = RefHelper::RawAs<Backend::DescriptorSetType>(packet.Sets[i]);
+				if (packet.DynamicOffsetMask & BIT(i))
+				{
+					dynamicOffset[0] = packet.DynamicOffsets[i];
+					set->Bind(packet.GraphicsPipeline, commandBuffer, PipelineBindPoint::Graphics, dynamicOffset);
+				}
+				else
+				{
+					set->Bind(packet.GraphicsPipeline, commandBuffer, PipelineBindPoint::Graphics, { });
+				}
+			}
+
+			if (packet.Vertexbuffer)
+				RefHelper::RawAs<Backend::VertexBufferType>(packet.Vertexbuffer)->Bind(commandBuffer);
+
+			if (packet.Indexbuffer)
+			{
+				RefHelper::RawAs<Backend::IndexBufferType>(packet.Indexbuffer)->Bind(commandBuffer);
+				Renderer::DrawIndexed(commandBuffer, packet.Indexbuffer);
+			}
+			else
+			{
+				Renderer::Draw(commandBuffer, packet.VertexCount);
+			}
+		}
+	}
+
+	void DrawQueue::Clear()
+	{
+		m_Packets.clear();
+
+		for (auto& pass : m_Passes)
+			pass.clear();
+
+		m_Sorted = true;
+	}
+
+	Ref<DrawQueue> DrawQueue::Create()
+	{
+		return RefHelper::Create<DrawQueue>();
+	}
+
+	void DrawQueue::RadixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch)
+	{
+		// Note(Jorben): LSD radix sort over the 7 lower bytes (the pass byte is equal for all entries), stable so equal keys keep submission order
+		scratch.resize(entries.size());
+
+		for (uint32_t shift = 0; shift < 56; shift += 8)
+		{
+			std::array<size_t, 256> counts = { };
+			for (const Entry& entry : entries)
+				counts[(entry.Key >> shift) & 0xFF]++;
+
+			// Note(Jorben): Skip digits where every key is the same
+			if (counts[(entries[0].Key >> shift) & 0xFF] == entries.size())
+				continue;
+
+			size_t offset = 0;
+			for (size_t& count : counts)
+			{
+				size_t current = count;
+				count = offset;
+				offset += current;
+			}
+
+			for (const Entry& entry : entries)
+				scratch[counts[(entry.Key >> shift) & 0xFF]++] = entry;
+
+			entries.swap(scratch);
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "Swift/Core/Core.hpp"
+#include "Swift/Utils/Utils.hpp"
+
+namespace Swift
+{
+
+	class Pipeline;
+	class DescriptorSet;
+	class VertexBuffer;
+	class IndexBuffer;
+	class CommandBuffer;
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Specifications
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Note(Jorben): Draws are recorded in ascending key order, so the most significant bits change the least.
+	struct SortKey
+	{
+	public:
+		// Note(Jorben): Pass (8) | Pipeline (16) | Material (16) | Depth (24), front to back for early-Z.
+		static uint64_t Opaque(uint8_t pass, uint16_t pipeline, uint16_t material, float depth);
+		// Note(Jorben): Pass (8) | Inverted depth (24) | Pipeline (16) | Material (16), back to front for correct blending.
+		static uint64_t Transparent(uint8_t pass, float depth, uint16_t pipeline, uint16_t material);
+
+		inline static uint8_t GetPass(uint64_t key) { return (uint8_t)(key >> 56); }
+
+	private:
+		static uint64_t QuantizeDepth(float depth); // Note(Jorben): Depth is expected to be normalized (0 to 1)
+	};
+
+	struct DrawPacket
+	{
+	public:
+		inline static constexpr const size_t s_MaxDescriptorSets = 4;
+
+		Ref<Pipeline> GraphicsPipeline = nullptr;
+
+		std::array<Ref<DescriptorSet>, s_MaxDescriptorSets> Sets = { };
+		std::array<uint32_t, s_MaxDescriptorSets> DynamicOffsets = { };
+		uint8_t DynamicOffsetMask = 0; // Note(Jorben): Bit N means Sets[N] gets bound with DynamicOffsets[N]
+
+		Ref<VertexBuffer> Vertexbuffer = nullptr;
+		Ref<IndexBuffer> Indexbuffer = nullptr;
+		uint32_t VertexCount = 3; // Note(Jorben): Only used when there is no index buffer
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// DrawQueue
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Note(Jorben): Collects the draws of a frame, sorts them per pass and records them in a state coherent order.
+	class DrawQueue
+	{
+	public:
+		DrawQueue() = default;
+		virtual ~DrawQueue() = default;
+
+		void Submit(uint64_t key, const DrawPacket& packet);
+
+		// Note(Jorben): Sorts every pass, the passes are sorted in parallel.
+		void Sort();
+		// Note(Jorben): Records all draws of a pass (sorting first if needed), pipelines only get (re)bound when they change.
+		void Record(uint8_t pass, const Ref<CommandBuffer>& commandBuffer);
+
+		void Clear();
+
+		inline size_t Size(uint8_t pass) const { return m_Passes[pass].size(); }
+
+		static Ref<DrawQueue> Create();
+
+	private:
+		struct Entry
+		{
+		public:
+			uint64_t Key = 0;
+			uint32_t Packet = 0;
+		};
+
+	private:
+		static void RadixSort(std::vector<Entry>& entries, std::vector<Entry>& scratch);
+
+	private:
+		std::vector<DrawPacket> m_Packets = { };
+
+		std::array<std::vector<Entry>, 256> m_Passes = { };
+		std::array<std::vector<Entry>, 256> m_Scratch = { };
+		bool m_Sorted = true;
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+#include "swpch.h"
+#include "FrameStatistics.hpp"
+
+#include <cmath>
+#include <algorithm>
+
+namespace Swift
+{
+
+	void FrameStatistics::Push(const FrameSample& sample)
+	{
+		uint64_t index = m_Count.load(std::memory_order_relaxed);
+		Slot& slot = m_Slots[index % HistorySize];
+
+		uint64_t sequence = slot.Sequence.load(std::memory_order_relaxed);
+		slot.Sequence.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		slot.Sample = sample;
+		slot.Sample.Frame = index;
+
+		slot.Sequence.store(sequence + 2, std::memory_order_release);
+		m_Count.store(index + 1, std::memory_order_release);
+	}
+
+	std::vector<FrameSample> FrameStatistics::GetHistory() const
+	{
+		uint64_t count = m_Count.load(std::memory_order_acquire);
+		uint64_t first = (count > HistorySize ? count - HistorySize : 0);
+
+		std::vector<FrameSample> samples = { };
+		samples.reserve((size_t)(count - first));
+
+		for (uint64_t i = first; i < count; i++)
+		{
+			FrameSample sample = {};
+			if (Read(i, sample))
+				samples.push_back(sample);
+		}
+
+		return samples;
+	}
+
+	FrameSample FrameStatistics::GetLatest() const
+	{
+		FrameSample sample = {};
+
+		uint64_t count = m_Count.load(std::memory_order_acquire);
+		if (count > 0)
+			Read(count - 1, sample);
+
+		return sample;
+	}
+
+	StatisticSummary FrameStatistics::Summarize(const std::function<float(const FrameSample&)>& value) const
+	{
+		StatisticSummary summary = {};
+
+		std::vector<FrameSample> history = GetHistory();
+		if (history.empty())
+			return summary;
+
+		std::vector<float> values = { };
+		values.reserve(history.size());
+
+		double total = 0.0;
+		for (const auto& sample : history)
+		{
+			float v = value(sample);
+			values.push_back(v);
+			total += (double)v;
+		}
+
+		std::sort(values.begin(), values.end());
+
+		// Note(Jorben): Nearest rank, so with less than 100 samples this is the maximum
+		size_t rank = (size_t)std::ceil(0.99 * (double)values.size());
+
+		summary.Min = values.front();
+		summary.Average = (float)(total / (double)values.size());
+		summary.P99 = values[std::max<size_t>(rank, 1) - 1];
+
+		return summary;
+	}
+
+	float FrameStatistics::GetFPS() const
+	{
+		float frameTime = Summarize([](const FrameSample& sample) { return sample.FrameTime; }).Average;
+		if (frameTime <= 0.0f)
+			return 0.0f;
+
+		return 1000.0f / frameTime;
+	}
+
+	bool FrameStatistics::Read(uint64_t index, FrameSample& sample) const
+	{
+		const Slot& slot = m_Slots[index % HistorySize];
+
+		uint64_t before = slot.Sequence.load(std::memory_order_acquire);
+		if (before & 1)
+			return false;
+
+		sample = slot.Sample;
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		uint64_t after = slot.Sequence.load(std::memory_order_relaxed);
+
+		// Note(Jorben): The slot got (or is being) overwritten by a newer frame while copying
+		return (before == after) && (sample.Frame == index);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <functional>
+
+#include "Swift/Core/Core.hpp"
+
+#include "Swift/Renderer/RendererConfig.hpp"
+
+namespace Swift
+{
+
+	// Note(Jorben): Plain data on purpose, so it can be copied in and out of the history without locking.
+	struct FrameSample
+	{
+	public:
+		uint64_t Frame = 0;
+
+		// Note(Jorben): CPU times in milliseconds
+		float FrameTime = 0.0f; // Time since the previous frame ended
+		float BeginFrameTime = 0.0f;
+		float LayerTime = 0.0f;
+		float EndFrameTime = 0.0f;
+
+		uint32_t DrawCalls = 0;
+		uint32_t Triangles = 0;
+		uint32_t Instances = 0;
+		uint32_t Binds = 0;
+		uint32_t ElidedBinds = 0;
+		uint32_t Submits = 0;
+		uint32_t Barriers = 0;
+		uint32_t DescriptorWrites = 0;
+		uint32_t Allocations = 0;
+		uint64_t UploadedBytes = 0;
+	};
+
+	struct StatisticSummary
+	{
+	public:
+		float Min = 0.0f;
+		float Average = 0.0f;
+		float P99 = 0.0f;
+	};
+
+	// Note(Jorben): Keeps the last HistorySize frames. There is only one writer (the thread that calls Renderer::EndFrame),
+	// but it can be read from any thread without locking. Samples that are being overwritten while reading get skipped.
+	class FrameStatistics
+	{
+	public:
+		inline static constexpr const size_t HistorySize = 256;
+	public:
+		FrameStatistics() = default;
+		virtual ~FrameStatistics() = default;
+
+		void Push(const FrameSample& sample);
+
+		std::vector<FrameSample> GetHistory() const; // Note(Jorben): Oldest first
+		FrameSample GetLatest() const;
+		StatisticSummary Summarize(const std::function<float(const FrameSample&)>& value) const;
+
+		float GetFPS() const; // Note(Jorben): Based on the average frame time of the history
+
+		inline uint64_t GetFrameCount() const { return m_Count.load(std::memory_order_acquire); }
+
+		// Note(Jorben): Set by the Application every frame. In pipelined mode it belongs to the frame that was being recorded at the time.
+		inline void SetLayerTime(float milliseconds) { m_LayerTime.store(milliseconds, std::memory_order_relaxed); }
+		inline float GetLayerTime() const { return m_LayerTime.load(std::memory_order_relaxed); }
+
+	private:
+		bool Read(uint64_t index, FrameSample& sample) const;
+
+	private:
+		struct Slot
+		{
+		public:
+			std::atomic<uint64_t> Sequence = 0; // Note(Jorben): Odd while being written to
+			FrameSample Sample = {};
+		};
+
+		std::array<Slot, HistorySize> m_Slots = { };
+		std::atomic<uint64_t> m_Count = 0;
+
+		std::atomic<float> m_LayerTime = 0.0f;
+	};
+
+}
\ No newline at end of file
@@ -5,7 +5,11 @@
 
 #include "Swift/Renderer/Renderer.hpp"
 
+#if !defined(APP_RENDERER_NULL)
 #include "Swift/Vulkan/VulkanImage.hpp"
+#endif
+
+#include "Swift/Null/NullResources.hpp"
 
 namespace Swift
 {
@@ -24,8 +28,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanImage2D>(specs);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullImage2D>(specs);
 
 		default:
 			APP_LOG_ERROR("Invalid API selected.");
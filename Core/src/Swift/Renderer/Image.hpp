@@ -70,7 +70,7 @@ namespace Swift
 
 		virtual void Resize(uint32_t width, uint32_t height) = 0;
 
-		virtual void Upload(Ref<DescriptorSet> set, Descriptor element) = 0;
+		virtual void Upload(const Ref<DescriptorSet>& set, Descriptor element) = 0;
 		virtual void Transition(ImageLayout initial, ImageLayout final) = 0;
 
 		virtual ImageSpecification& GetSpecification() = 0;
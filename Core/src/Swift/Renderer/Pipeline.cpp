@@ -8,7 +8,11 @@
 #include "Swift/Renderer/RenderPass.hpp"
 #include "Swift/Renderer/Descriptors.hpp"
 
+#if !defined(APP_RENDERER_NULL)
 #include "Swift/Vulkan/VulkanPipeline.hpp"
+#endif
+
+#include "Swift/Null/NullResources.hpp"
 
 namespace Swift
 {
@@ -17,8 +21,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanPipeline>(specs, sets, shader, renderpass);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullPipeline>(specs, sets);
 
 		default:
 			APP_ASSERT(false, "Invalid API selected.");
@@ -28,12 +37,22 @@ namespace Swift
 		return nullptr;
 	}
 
+	Ref<Pipeline> Pipeline::Create(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<ShaderVariants> shader, uint32_t variant, Ref<RenderPass> renderpass)
+	{
+		return Create(specs, sets, shader->Get(variant), renderpass);
+	}
+
 	Ref<Pipeline> Pipeline::Create(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<ComputeShader> shader)
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanPipeline>(specs, sets, shader);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullPipeline>(specs, sets);
 
 		default:
 			APP_ASSERT(false, "Invalid API selected.");
@@ -9,9 +9,11 @@ namespace Swift
 {
 
 	class Shader;
+	class ShaderVariants;
 	class ComputeShader;
 	class RenderPass;
 	class DescriptorSets;
+	class BindlessDescriptors;
 	class CommandBuffer;
 
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +29,14 @@ namespace Swift
 		None = 0x7FFFFFFF, Fill = 0, Line = 1
 	};
 
+	// Note(Jorben): State marked as dynamic is set on the commandbuffer instead of being baked into the pipeline (if the device supports it).
+	enum class PipelineDynamicState : uint8_t
+	{
+		None = 0, CullingMode = BIT(0), PolygonMode = BIT(1), DepthTest = BIT(2), DepthWrite = BIT(3), Blending = BIT(4),
+		All = CullingMode | PolygonMode | DepthTest | DepthWrite | Blending
+	};
+	DEFINE_BITWISE_OPS(PipelineDynamicState)
+
 	struct PipelineSpecification
 	{
 	public:
@@ -37,6 +47,15 @@ namespace Swift
 
 		float LineWidth = 1.0f;
 		bool Blending = false;
+
+		bool DepthTest = true;
+		bool DepthWrite = true;
+
+		PipelineDynamicState DynamicState = PipelineDynamicState::None;
+
+		// Note(Jorben): Push constants are available to all stages of the pipeline (e.g. for a material/object index into bindless arrays).
+		uint32_t PushConstantSize = 0;
+		Ref<BindlessDescriptors> Bindless = nullptr;
 	};
 
 	enum class PipelineBindPoint
@@ -53,12 +72,21 @@ namespace Swift
 		Pipeline() = default;
 		virtual ~Pipeline() = default;
 
-		virtual void Use(Ref<CommandBuffer> commandBuffer, PipelineBindPoint bindPoint = PipelineBindPoint::Graphics) = 0;
+		virtual void Use(const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint = PipelineBindPoint::Graphics) = 0;
+
+		// Note(Jorben): These can be called after Use(), when the state isn't dynamic (or not supported) a matching pipeline gets created/bound instead.
+		virtual void SetCullingMode(const Ref<CommandBuffer>& commandBuffer, CullingMode mode) = 0;
+		virtual void SetPolygonMode(const Ref<CommandBuffer>& commandBuffer, PolygonMode mode) = 0;
+		virtual void SetDepthState(const Ref<CommandBuffer>& commandBuffer, bool test, bool write) = 0;
+		virtual void SetBlending(const Ref<CommandBuffer>& commandBuffer, bool enabled) = 0;
+
+		virtual void PushConstants(const Ref<CommandBuffer>& commandBuffer, const void* data, uint32_t size, uint32_t offset = 0) = 0;
 
 		virtual PipelineSpecification& GetSpecification() = 0;
-		virtual Ref<DescriptorSets> GetDescriptorSets() = 0;
+		virtual const Ref<DescriptorSets>& GetDescriptorSets() = 0;
 
 		static Ref<Pipeline> Create(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<Shader> shader, Ref<RenderPass> renderpass);
+		static Ref<Pipeline> Create(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<ShaderVariants> shader, uint32_t variant, Ref<RenderPass> renderpass);
 		static Ref<Pipeline> Create(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<ComputeShader> shader);
 	};
 
@@ -5,7 +5,11 @@
 
 #include "Swift/Renderer/Renderer.hpp"
 
+#if !defined(APP_RENDERER_NULL)
 #include "Swift/Vulkan/VulkanRenderer.hpp"
+#endif
+
+#include "Swift/Null/NullRenderer.hpp"
 
 namespace Swift
 {
@@ -14,8 +18,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return new VulkanRenderer();
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return new NullRenderer();
 
 		default:
 			APP_ASSERT(false, "Invalid API selected.");
@@ -11,6 +11,7 @@ namespace Swift
 {
 
 	class CommandBuffer;
+	class Pipeline;
 	class IndexBuffer;
 	class Image2D;
 
@@ -30,8 +31,9 @@ namespace Swift
 
 		virtual void Wait() = 0;
 
-		virtual void Draw(Ref<CommandBuffer> commandBuffer, uint32_t verticeCount) = 0;
-		virtual void DrawIndexed(Ref<CommandBuffer> commandBuffer, Ref<IndexBuffer> indexBuffer) = 0;
+		virtual void Draw(const Ref<CommandBuffer>& commandBuffer, uint32_t verticeCount) = 0;
+		virtual void DrawIndexed(const Ref<CommandBuffer>& commandBuffer, const Ref<IndexBuffer>& indexBuffer) = 0;
+		virtual void DrawBatch(const Ref<CommandBuffer>& commandBuffer, const Ref<Pipeline>& pipeline, std::span<const DrawCommand> commands) = 0;
 
 		virtual void OnResize(uint32_t width, uint32_t height) = 0;
 
@@ -34,6 +34,8 @@ namespace Swift
 		LoadOperation DepthLoadOp = LoadOperation::Clear;
 		ImageLayout PreviousDepthImageLayout = ImageLayout::Undefined;
 		ImageLayout FinalDepthImageLayout = ImageLayout::Depth;
+
+		std::string Name = "RenderPass"; // Note(Jorben): Used for the GPU timings in the RenderData
 	};
 
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
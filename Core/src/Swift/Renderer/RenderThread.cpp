@@ -0,0 +1,133 @@
+#include "swpch.h"
+#include "RenderThread.hpp"
+
+#include "Swift/Core/Logging.hpp"
+
+#include "Swift/Utils/Profiler.hpp"
+
+#include "Swift/Renderer/Renderer.hpp"
+
+namespace Swift
+{
+
+	bool RenderThread::s_Enabled = false;
+	bool RenderThread::s_Running = false;
+	bool RenderThread::s_Pending = false;
+
+	std::thread RenderThread::s_Thread = {};
+	std::mutex RenderThread::s_Mutex = {};
+	std::condition_variable RenderThread::s_Condition = {};
+
+	std::array<Utils::Queue<RenderFunction>, 2> RenderThread::s_Lists = { };
+	uint32_t RenderThread::s_RecordIndex = 0;
+	uint32_t RenderThread::s_RenderIndex = 1;
+
+	static thread_local bool s_IsRenderThread = false;
+
+	void RenderThread::Init()
+	{
+		APP_ASSERT(!s_Enabled, "Render thread has already been initialized.");
+
+		s_Running = true;
+		s_Pending = false;
+		s_Thread = std::thread(&RenderThread::Loop);
+
+		s_Enabled = true;
+	}
+
+	void RenderThread::Destroy()
+	{
+		if (!s_Enabled)
+			return;
+
+		{
+			std::scoped_lock<std::mutex> lock(s_Mutex);
+			s_Running = false;
+		}
+		s_Condition.notify_all();
+
+		s_Thread.join();
+		s_Enabled = false;
+
+		// Note(Jorben): Whatever was recorded after the last Kick() never gets rendered
+		s_Lists[s_RecordIndex].Clear();
+	}
+
+	bool RenderThread::IsRenderThread()
+	{
+		return s_IsRenderThread;
+	}
+
+	void RenderThread::Submit(RenderFunction function)
+	{
+		s_Lists[s_RecordIndex].Add(function);
+	}
+
+	void RenderThread::Kick()
+	{
+		APP_PROFILE_SCOPE("RenderThread::Kick");
+		{
+			std::unique_lock<std::mutex> lock(s_Mutex);
+			s_Condition.wait(lock, []() { return !s_Pending; });
+
+			// Note(Jorben): The render thread is idle here, so the finished frame's data can be copied for the main thread
+			Renderer::UpdateSnapshot();
+
+			s_RenderIndex = s_RecordIndex;
+			s_RecordIndex = (s_RecordIndex + 1) % (uint32_t)s_Lists.size();
+			s_Pending = true;
+		}
+		s_Condition.notify_all();
+	}
+
+	void RenderThread::Wait()
+	{
+		if (!s_Enabled || s_IsRenderThread)
+			return;
+
+		APP_PROFILE_SCOPE("RenderThread::Wait");
+		std::unique_lock<std::mutex> lock(s_Mutex);
+		s_Condition.wait(lock, []() { return !s_Pending; });
+	}
+
+	void RenderThread::Loop()
+	{
+		s_IsRenderThread = true;
+		APP_PROFILE_THREAD("Render Thread");
+
+		while (true)
+		{
+			uint32_t index = 0;
+			{
+				std::unique_lock<std::mutex> lock(s_Mutex);
+				s_Condition.wait(lock, []() { return s_Pending || !s_Running; });
+
+				// Note(Jorben): A frame that was already handed off still gets finished before stopping
+				if (!s_Pending)
+					break;
+
+				index = s_RenderIndex;
+			}
+
+			{
+				APP_PROFILE_SCOPE("Renderer::Begin");
+				Renderer::BeginFrame();
+			}
+			{
+				APP_PROFILE_SCOPE("RenderThread::Execute");
+				s_Lists[index].Execute();
+			}
+			{
+				APP_PROFILE_SCOPE("Renderer::End");
+				Renderer::EndFrame();
+			}
+
+			{
+				std::scoped_lock<std::mutex> lock(s_Mutex);
+				s_Pending = false;
+			}
+			s_Condition.notify_all();
+		}
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "Swift/Core/Core.hpp"
+#include "Swift/Utils/Utils.hpp"
+
+#include "Swift/Renderer/RendererConfig.hpp"
+
+namespace Swift
+{
+
+	// Note(Jorben): Used when ApplicationSpecification::Threading is ThreadingMode::Pipelined.
+	// The main thread runs OnUpdate & OnRender of frame N + 1 while this thread executes the render functions of frame N,
+	// which makes it the only thread that calls Renderer::BeginFrame/EndFrame.
+	// 
+	// Rules for layers in pipelined mode:
+	// - Anything submitted with Renderer::Submit runs a frame later on the render thread, so render functions have to capture
+	//   by value (Refs, matrices, counts) and must never read layer members that OnUpdate writes to.
+	// - Per frame resources (uniform buffers, descriptor sets, ...) should only be written from within render functions,
+	//   since Renderer::GetCurrentFrame() belongs to the render thread.
+	// - Resources that upload data on creation (buffers, images, ...) use the same queue & command pool as the render thread,
+	//   so create them in OnAttach (before the first frame is handed off) or from within a render function.
+	//   Destroying them anywhere is fine, destruction is already deferred through Renderer::SubmitFree.
+	// - Not supported together with the ImGui extension, ImGui & GLFW can't be used from the render thread
+	//   (the extension asserts and runs in ThreadingMode::Serial instead).
+	class RenderThread
+	{
+	public:
+		static void Init();
+		static void Destroy();
+
+		inline static bool Enabled() { return s_Enabled; }
+		static bool IsRenderThread();
+
+		// Note(Jorben): Adds to the list that is currently being recorded, it gets executed after the next Kick().
+		static void Submit(RenderFunction function);
+
+		// Note(Jorben): Waits for the previous frame to finish, swaps the lists and starts rendering the recorded one.
+		static void Kick();
+		// Note(Jorben): Blocks until the render thread is idle, needed before touching the swapchain from the main thread (e.g. resizing).
+		static void Wait();
+
+	private:
+		static void Loop();
+
+	private:
+		static bool s_Enabled;
+		static bool s_Running;
+		static bool s_Pending; // Note(Jorben): A frame has been handed off and is not finished yet
+
+		static std::thread s_Thread;
+		static std::mutex s_Mutex;
+		static std::condition_variable s_Condition;
+
+		// Note(Jorben): One list is being recorded by the main thread while the other gets executed by the render thread
+		static std::array<Utils::Queue<RenderFunction>, 2> s_Lists;
+		static uint32_t s_RecordIndex;
+		static uint32_t s_RenderIndex;
+	};
+
+}
\ No newline at end of file
@@ -5,8 +5,12 @@
 
 #include "Swift/Renderer/Renderer.hpp"
 
+#if !defined(APP_RENDERER_NULL)
 #include "Swift/Vulkan/VulkanShader.hpp"
 #include "Swift/Vulkan/VulkanRenderer.hpp"
+#endif
+
+#include "Swift/Null/NullResources.hpp"
 
 namespace Swift
 {
@@ -56,8 +60,13 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanShaderCompiler>();
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullShaderCompiler>();
 
 		default:
 			APP_ASSERT(false, "Invalid API selected.");
@@ -67,6 +76,150 @@ namespace Swift
 		return nullptr;
 	}
 
+	std::string ShaderCompileOptions::ToString() const
+	{
+		std::string result = fmt::format("optimization={0};", (uint32_t)Optimization);
+
+		for (auto& [name, value] : Defines)
+			result += fmt::format("{0}={1};", name, value);
+
+		return result;
+	}
+
+	static std::string ResolveIncludesImpl(const std::filesystem::path& shader, std::set<std::filesystem::path>& included)
+	{
+		std::filesystem::path path = std::filesystem::weakly_canonical(shader);
+		if (included.contains(path))
+			return {};
+
+		included.insert(path);
+
+		std::istringstream source(ShaderSpecification::ReadGLSLFile(path));
+		std::string result = {};
+		std::string line = {};
+
+		while (std::getline(source, line))
+		{
+			size_t start = line.find_first_not_of(" \t");
+			if (start != std::string::npos && line.compare(start, 8, "#include") == 0)
+			{
+				size_t open = line.find('"', start);
+				size_t close = line.find('"', open + 1);
+
+				if (open != std::string::npos && close != std::string::npos)
+				{
+					result += ResolveIncludesImpl(path.parent_path() / line.substr(open + 1, close - open - 1), included);
+					continue;
+				}
+			}
+
+			result += line;
+			result += '\n';
+		}
+
+		return result;
+	}
+
+	ShaderCacher::ShaderCacher(const std::filesystem::path& directory)
+		: m_Directory(directory)
+	{
+		if (!std::filesystem::exists(m_Directory))
+			std::filesystem::create_directories(m_Directory);
+
+		LoadManifest();
+	}
+
+	bool ShaderCacher::CacheUpToDate(Ref<ShaderCompiler> compiler, const std::filesystem::path& shader, ShaderStage stage, const ShaderCompileOptions& options)
+	{
+		auto it = m_Entries.find(GetIdentity(shader, stage, options));
+		if (it == m_Entries.end())
+			return false;
+
+		return it->second.Hash == GetHash(compiler, ResolveIncludes(shader), stage, options) && std::filesystem::exists(m_Directory / it->second.File);
+	}
+
+	std::vector<char> ShaderCacher::GetLatest(Ref<ShaderCompiler> compiler, const std::filesystem::path& shader, ShaderStage stage, const ShaderCompileOptions& options)
+	{
+		uint64_t identity = GetIdentity(shader, stage, options);
+		std::string source = ResolveIncludes(shader);
+		uint64_t hash = GetHash(compiler, source, stage, options);
+
+		auto it = m_Entries.find(identity);
+		if (it != m_Entries.end() && it->second.Hash == hash && std::filesystem::exists(m_Directory / it->second.File))
+			return Retrieve(m_Directory / it->second.File);
+
+		auto result = compiler->Compile(source, stage, options, shader.filename().string());
+
+		Entry& entry = m_Entries[identity];
+		entry.Hash = hash;
+		entry.File = fmt::format("{0}.{1:016x}.cache", shader.stem().string(), identity);
+
+		Cache(m_Directory / entry.File, result);
+		SaveManifest();
+
+		return result;
+	}
+
+	std::vector<std::vector<char>> ShaderCacher::GetLatest(Ref<ShaderCompiler> compiler, const std::vector<ShaderCacheRequest>& requests)
+	{
+		std::vector<std::vector<char>> results(requests.size());
+
+		std::vector<ShaderCompileJob> jobs = { };
+		std::vector<size_t> jobIndices = { };
+		std::vector<std::pair<uint64_t, uint64_t>> jobKeys = { }; // Identity, Hash
+
+		for (size_t i = 0; i < requests.size(); i++)
+		{
+			const ShaderCacheRequest& request = requests[i];
+
+			uint64_t identity = GetIdentity(request.Shader, request.Stage, request.Options);
+			std::string source = ResolveIncludes(request.Shader);
+			uint64_t hash = GetHash(compiler, source, request.Stage, request.Options);
+
+			auto it = m_Entries.find(identity);
+			if (it != m_Entries.end() && it->second.Hash == hash && std::filesystem::exists(m_Directory / it->second.File))
+			{
+				results[i] = Retrieve(m_Directory / it->second.File);
+				continue;
+			}
+
+			jobs.push_back({ request.Shader.filename().string(), std::move(source), request.Stage, request.Options });
+			jobIndices.push_back(i);
+			jobKeys.push_back({ identity, hash });
+		}
+
+		if (jobs.empty())
+			return results;
+
+		auto compiled = compiler->CompileBatch(jobs);
+		for (size_t i = 0; i < compiled.size(); i++)
+		{
+			const ShaderCacheRequest& request = requests[jobIndices[i]];
+			auto [identity, hash] = jobKeys[i];
+
+			Entry& entry = m_Entries[identity];
+			entry.Hash = hash;
+			entry.File = fmt::format("{0}.{1:016x}.cache", request.Shader.stem().string(), identity);
+
+			Cache(m_Directory / entry.File, compiled[i]);
+			results[jobIndices[i]] = std::move(compiled[i]);
+		}
+
+		SaveManifest();
+		return results;
+	}
+
+	std::string ShaderCacher::ResolveIncludes(const std::filesystem::path& shader)
+	{
+		std::set<std::filesystem::path> included = { };
+		return ResolveIncludesImpl(shader, included);
+	}
+
+	Ref<ShaderCacher> ShaderCacher::Create(const std::filesystem::path& directory)
+	{
+		return RefHelper::Create<ShaderCacher>(directory);
+	}
+
 	void ShaderCacher::Cache(const std::filesystem::path& path, const std::vector<char>& code)
 	{
 		std::ofstream file(path, std::ios::binary);
@@ -87,41 +240,205 @@ namespace Swift
 		return ShaderSpecification::ReadSPIRVFile(path);
 	}
 
-	bool ShaderCacher::CacheUpToDate(const std::filesystem::path& cache, const std::filesystem::path& shader)
+	void ShaderCacher::LoadManifest()
 	{
-		if (!std::filesystem::exists(cache) || !std::filesystem::exists(shader))
+		std::ifstream file(m_Directory / "manifest");
+		if (!file.is_open() || !file.good())
+			return;
+
+		// Note(Jorben): Every line is: <identity> <hash> <file>
+		std::string line = {};
+		while (std::getline(file, line))
 		{
-			APP_LOG_WARN("Failed to check if cache is up to date since file was invalid or doesn't exist yet.");
-			return false;
-		}
+			std::istringstream stream(line);
+
+			uint64_t identity = 0;
+			Entry entry = {};
+			if (!(stream >> std::hex >> identity >> entry.Hash))
+				continue;
 
-		auto cacheTime = std::filesystem::last_write_time(cache);
-		auto shaderTime = std::filesystem::last_write_time(shader);
+			std::getline(stream >> std::ws, entry.File);
+			m_Entries[identity] = entry;
+		}
 
-		return cacheTime >= shaderTime;
+		file.close();
 	}
 
-	std::vector<char> ShaderCacher::GetLatest(Ref<ShaderCompiler> compiler, const std::filesystem::path& cache, const std::filesystem::path& shader, ShaderStage stage)
+	void ShaderCacher::SaveManifest()
 	{
-		if (CacheUpToDate(cache, shader))
-			return Retrieve(cache);
+		std::ofstream file(m_Directory / "manifest");
 
-		auto result = compiler->Compile(ShaderSpecification::ReadGLSLFile(shader), stage);
-		Cache(cache, result);
-		return result;
+		if (!file.is_open() || !file.good())
+		{
+			APP_LOG_ERROR("Failed to write shader cache manifest to '{0}'", m_Directory.string());
+			return;
+		}
+
+		for (auto& [identity, entry] : m_Entries)
+			file << fmt::format("{0:016x} {1:016x} {2}\n", identity, entry.Hash, entry.File);
+
+		file.close();
+	}
+
+	uint64_t ShaderCacher::GetIdentity(const std::filesystem::path& shader, ShaderStage stage, const ShaderCompileOptions& options) const
+	{
+		uint64_t hash = Utils::ToolKit::Hash(shader.lexically_normal().generic_string());
+		hash = Utils::ToolKit::Hash(&stage, sizeof(ShaderStage), hash);
+		return Utils::ToolKit::Hash(options.ToString(), hash);
 	}
 
-	Ref<ShaderCacher> ShaderCacher::Create()
+	uint64_t ShaderCacher::GetHash(Ref<ShaderCompiler> compiler, const std::string& source, ShaderStage stage, const ShaderCompileOptions& options) const
 	{
-		return RefHelper::Create<ShaderCacher>();
+		uint64_t hash = Utils::ToolKit::Hash(source);
+		hash = Utils::ToolKit::Hash(&stage, sizeof(ShaderStage), hash);
+		hash = Utils::ToolKit::Hash(options.ToString(), hash);
+		return Utils::ToolKit::Hash(compiler->GetVersion(), hash);
 	}
 
 	Ref<Shader> Shader::Create(ShaderSpecification specs)
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanShader>(specs);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullShader>(specs.Vertex.size() + specs.Fragment.size());
+
+		default:
+			APP_ASSERT(false, "Invalid API selected.");
+			break;
+		}
+
+		return nullptr;
+	}
+
+	ShaderVariants::ShaderVariants(Ref<ShaderCompiler> compiler, Ref<ShaderCacher> cacher, const std::filesystem::path& vertex, const std::filesystem::path& fragment)
+		: m_Compiler(compiler), m_Cacher(cacher), m_Vertex(vertex), m_Fragment(fragment)
+	{
+		for (auto& path : { m_Vertex, m_Fragment })
+		{
+			std::istringstream source(ShaderCacher::ResolveIncludes(path));
+			std::string line = {};
+
+			while (std::getline(source, line))
+			{
+				std::istringstream stream(line);
+				std::string pragma = {}, type = {}, keyword = {};
+
+				if (!(stream >> pragma >> type) || pragma != "#pragma" || type != "keywords")
+					continue;
+
+				while (stream >> keyword)
+				{
+					if (std::find(m_Keywords.begin(), m_Keywords.end(), keyword) == m_Keywords.end())
+						m_Keywords.push_back(keyword);
+				}
+			}
+		}
+
+		APP_ASSERT((m_Keywords.size() <= 32), "Shader '{0}' declares more than 32 keywords.", m_Vertex.string());
+	}
+
+	Ref<Shader> ShaderVariants::Get(uint32_t mask)
+	{
+		mask = Normalize(mask);
+
+		auto it = m_Variants.find(mask);
+		if (it != m_Variants.end())
+			return it->second;
+
+		Precompile({ mask });
+		return m_Variants[mask];
+	}
+
+	void ShaderVariants::Precompile(const std::vector<uint32_t>& masks)
+	{
+		std::vector<uint32_t> missing = { };
+		std::vector<ShaderCacheRequest> requests = { };
+
+		for (uint32_t requested : masks)
+		{
+			uint32_t mask = Normalize(requested);
+			if (m_Variants.contains(mask) || std::find(missing.begin(), missing.end(), mask) != missing.end())
+				continue;
+
+			ShaderCompileOptions options = GetOptions(mask);
+			requests.push_back({ m_Vertex, ShaderStage::Vertex, options });
+			requests.push_back({ m_Fragment, ShaderStage::Fragment, options });
+			missing.push_back(mask);
+		}
+
+		if (missing.empty())
+			return;
+
+		Utils::Timer timer = {};
+		auto results = m_Cacher->GetLatest(m_Compiler, requests);
+		m_LoadTime += timer.GetPassedTime();
+
+		for (size_t i = 0; i < missing.size(); i++)
+		{
+			ShaderSpecification specs = {};
+			specs.Vertex = std::move(results[i * 2]);
+			specs.Fragment = std::move(results[i * 2 + 1]);
+
+			m_Variants[missing[i]] = Shader::Create(specs);
+		}
+	}
+
+	uint32_t ShaderVariants::GetMask(const std::vector<std::string>& keywords) const
+	{
+		uint32_t mask = 0;
+
+		for (auto& keyword : keywords)
+		{
+			auto it = std::find(m_Keywords.begin(), m_Keywords.end(), keyword);
+			if (it == m_Keywords.end())
+			{
+				APP_LOG_WARN("Keyword '{0}' is not declared by shader '{1}'.", keyword, m_Vertex.string());
+				continue;
+			}
+
+			mask |= BIT((uint32_t)(it - m_Keywords.begin()));
+		}
+
+		return mask;
+	}
+
+	void ShaderVariants::Report() const
+	{
+		APP_LOG_INFO("Shader '{0}' & '{1}': {2} variant(s) loaded out of {3} possible, took {4:.3f}ms.", m_Vertex.string(), m_Fragment.string(), m_Variants.size(), (uint64_t)1 << m_Keywords.size(), m_LoadTime * 1000.0);
+	}
+
+	Ref<ShaderVariants> ShaderVariants::Create(Ref<ShaderCompiler> compiler, Ref<ShaderCacher> cacher, const std::filesystem::path& vertex, const std::filesystem::path& fragment)
+	{
+		return RefHelper::Create<ShaderVariants>(compiler, cacher, vertex, fragment);
+	}
+
+	ShaderCompileOptions ShaderVariants::GetOptions(uint32_t mask) const
+	{
+		ShaderCompileOptions options = {};
+		options.Defines.reserve(m_Keywords.size());
+
+		for (size_t i = 0; i < m_Keywords.size(); i++)
+			options.Defines.push_back({ m_Keywords[i], (mask & BIT(i)) ? "1" : "0" });
+
+		return options;
+	}
+
+	Ref<Shader> Shader::Create(ShaderBlob vertex, ShaderBlob fragment)
+	{
+		switch (RendererSpecification::API)
+		{
+		#if !defined(APP_RENDERER_NULL)
+		case RendererSpecification::RenderingAPI::Vulkan:
+			return RefHelper::Create<VulkanShader>(vertex, fragment);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullShader>(vertex.Size + fragment.Size);
 
 		default:
 			APP_ASSERT(false, "Invalid API selected.");
@@ -135,8 +452,33 @@ namespace Swift
 	{
 		switch (RendererSpecification::API)
 		{
+		#if !defined(APP_RENDERER_NULL)
 		case RendererSpecification::RenderingAPI::Vulkan:
 			return RefHelper::Create<VulkanComputeShader>(specs);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullComputeShader>(specs.Compute.size());
+
+		default:
+			APP_ASSERT(false, "Invalid API selected.");
+			break;
+		}
+
+		return nullptr;
+	}
+
+	Ref<ComputeShader> ComputeShader::Create(ShaderBlob compute)
+	{
+		switch (RendererSpecification::API)
+		{
+		#if !defined(APP_RENDERER_NULL)
+		case RendererSpecification::RenderingAPI::Vulkan:
+			return RefHelper::Create<VulkanComputeShader>(compute);
+		#endif
+
+		case RendererSpecification::RenderingAPI::None:
+			return RefHelper::Create<NullComputeShader>(compute.Size);
 
 		default:
 			APP_ASSERT(false, "Invalid API selected.");
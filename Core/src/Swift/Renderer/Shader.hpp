@@ -3,6 +3,7 @@
 #include <array>
 #include <vector>
 #include <optional>
+#include <functional>
 #include <filesystem>
 
 #include "Swift/Core/Core.hpp"
@@ -34,6 +35,65 @@ namespace Swift
 		virtual ~ShaderSpecification() = default;
 	};
 
+	// Note(Jorben): A non-owning view of SPIR-V code, the memory only has to stay alive until the shader is created.
+	struct ShaderBlob
+	{
+	public:
+		const uint32_t* Data = nullptr;
+		size_t Size = 0; // In bytes
+
+		inline bool Empty() const { return Data == nullptr || Size == 0; }
+	};
+
+	// Note(Jorben): Debug disables optimization and adds debug info, the other profiles strip the debug info.
+	enum class ShaderOptimization : uint8_t
+	{
+		Debug = 0, Performance, Size
+	};
+
+	struct ShaderCompileOptions
+	{
+	public:
+		std::vector<std::pair<std::string, std::string>> Defines = { }; // Name, Value
+
+		#if defined(APP_DEBUG)
+		ShaderOptimization Optimization = ShaderOptimization::Debug;
+		#else
+		ShaderOptimization Optimization = ShaderOptimization::Performance;
+		#endif
+
+		// Note(Jorben): Used as part of the shader cache key, so it has to describe everything that changes the output.
+		std::string ToString() const;
+	};
+
+	struct ShaderCompileReport
+	{
+	public:
+		std::string Name = {};
+		ShaderStage Stage = ShaderStage::None;
+		ShaderOptimization Optimization = ShaderOptimization::Debug;
+
+		size_t Size = 0; // In bytes
+		double Time = 0.0; // In milliseconds
+	};
+
+	struct ShaderCompileJob
+	{
+	public:
+		std::string Name = {}; // Note(Jorben): Only used for error messages and reports
+		std::string Code = {};
+		ShaderStage Stage = ShaderStage::None;
+		ShaderCompileOptions Options = {};
+	};
+
+	struct ShaderCacheRequest
+	{
+	public:
+		std::filesystem::path Shader = {};
+		ShaderStage Stage = ShaderStage::None;
+		ShaderCompileOptions Options = {};
+	};
+
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 	// Classes 
 	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,26 +103,62 @@ namespace Swift
 		ShaderCompiler() = default;
 		virtual ~ShaderCompiler() = default;
 
-		virtual std::vector<char> Compile(const std::string& code, ShaderStage stage) = 0;
+		virtual std::vector<char> Compile(const std::string& code, ShaderStage stage, const ShaderCompileOptions& options = {}, const std::string& name = "") = 0;
 		virtual ShaderSpecification Compile(const std::string& fragment, const std::string& vertex) = 0;
 
+		// Note(Jorben): Compiles all jobs in parallel on worker threads, the results are in the same order as the jobs.
+		// onCompleted gets called (from a worker thread, but never simultaneously) as soon as a job is done.
+		virtual std::vector<std::vector<char>> CompileBatch(const std::vector<ShaderCompileJob>& jobs, std::function<void(size_t index, const std::vector<char>& code)> onCompleted = nullptr) = 0;
+
+		// Note(Jorben): A report gets added for every compiled shader
+		virtual std::vector<ShaderCompileReport> GetReports() = 0;
+		virtual void LogReports() = 0;
+
+		// Note(Jorben): Identifies the compiler and its target, used as part of the shader cache key.
+		virtual std::string GetVersion() = 0;
+
 		static Ref<ShaderCompiler> Create();
 	};
 
+	// Note(Jorben): Caches are keyed by a hash of the include-resolved source, stage, options and compiler version.
+	// All caches are indexed by a single manifest in the cache directory, a cache hit never touches the compiler.
 	class ShaderCacher
 	{
 	public:
-		ShaderCacher() = default;
+		ShaderCacher(const std::filesystem::path& directory);
 		virtual ~ShaderCacher() = default;
 
+		bool CacheUpToDate(Ref<ShaderCompiler> compiler, const std::filesystem::path& shader, ShaderStage stage, const ShaderCompileOptions& options = {});
+
+		std::vector<char> GetLatest(Ref<ShaderCompiler> compiler, const std::filesystem::path& shader, ShaderStage stage, const ShaderCompileOptions& options = {});
+		// Note(Jorben): Cache hits are read directly, all misses get compiled together using ShaderCompiler::CompileBatch.
+		std::vector<std::vector<char>> GetLatest(Ref<ShaderCompiler> compiler, const std::vector<ShaderCacheRequest>& requests);
+
+		// Note(Jorben): Recursively inlines '#include "file"' relative to the including file, every file is only included once.
+		static std::string ResolveIncludes(const std::filesystem::path& shader);
+
+		static Ref<ShaderCacher> Create(const std::filesystem::path& directory);
+
+	private:
+		struct Entry
+		{
+		public:
+			uint64_t Hash = 0;
+			std::string File = {};
+		};
+
 		void Cache(const std::filesystem::path& path, const std::vector<char>& code);
 		std::vector<char> Retrieve(const std::filesystem::path& path);
 
-		bool CacheUpToDate(const std::filesystem::path& cache, const std::filesystem::path& shader);
+		void LoadManifest();
+		void SaveManifest();
 
-		std::vector<char> GetLatest(Ref<ShaderCompiler> compiler, const std::filesystem::path& cache, const std::filesystem::path& shader, ShaderStage stage);
+		uint64_t GetIdentity(const std::filesystem::path& shader, ShaderStage stage, const ShaderCompileOptions& options) const;
+		uint64_t GetHash(Ref<ShaderCompiler> compiler, const std::string& source, ShaderStage stage, const ShaderCompileOptions& options) const;
 
-		static Ref<ShaderCacher> Create();
+	private:
+		std::filesystem::path m_Directory = {};
+		Dict<uint64_t, Entry> m_Entries = { }; // Identity, Entry
 	};
 
 	class Shader
@@ -72,6 +168,45 @@ namespace Swift
 		virtual ~Shader() = default;
 
 		static Ref<Shader> Create(ShaderSpecification specs);
+		static Ref<Shader> Create(ShaderBlob vertex, ShaderBlob fragment);
+	};
+
+	// Note(Jorben): Permutation keywords are declared in the shader source as '#pragma keywords A B C' (in either stage).
+	// Bit N of a variant mask defines the N-th keyword as 1, otherwise it's defined as 0. So use '#if A' in the shader.
+	// Bits of undeclared keywords are ignored, so masks that only differ in those share one variant.
+	class ShaderVariants
+	{
+	public:
+		ShaderVariants(Ref<ShaderCompiler> compiler, Ref<ShaderCacher> cacher, const std::filesystem::path& vertex, const std::filesystem::path& fragment);
+		virtual ~ShaderVariants() = default;
+
+		// Note(Jorben): Compiles (or retrieves from the cache) the variant on first use.
+		Ref<Shader> Get(uint32_t mask);
+		// Note(Jorben): Compiles all not yet loaded variants ahead of time in a single batch.
+		void Precompile(const std::vector<uint32_t>& masks);
+
+		uint32_t GetMask(const std::vector<std::string>& keywords) const;
+		inline const std::vector<std::string>& GetKeywords() const { return m_Keywords; }
+
+		// Note(Jorben): Logs the amount of loaded variants and the time spent compiling/loading them.
+		void Report() const;
+
+		static Ref<ShaderVariants> Create(Ref<ShaderCompiler> compiler, Ref<ShaderCacher> cacher, const std::filesystem::path& vertex, const std::filesystem::path& fragment);
+
+	private:
+		inline uint32_t Normalize(uint32_t mask) const { return mask & (uint32_t)((1ull << m_Keywords.size()) - 1); }
+		ShaderCompileOptions GetOptions(uint32_t mask) const;
+
+	private:
+		Ref<ShaderCompiler> m_Compiler = nullptr;
+		Ref<ShaderCacher> m_Cacher = nullptr;
+		std::filesystem::path m_Vertex = {};
+		std::filesystem::path m_Fragment = {};
+
+		std::vector<std::string> m_Keywords = { };
+		Dict<uint32_t, Ref<Shader>> m_Variants = { };
+
+		double m_LoadTime = 0.0;
 	};
 
 	class ComputeShader
@@ -81,9 +216,10 @@ namespace Swift
 		virtual ~ComputeShader() = default;
 
 		// Note(Jorben): Make sure a pipeline with compute shader added is bound
-		virtual void Dispatch(Ref<CommandBuffer> commandBuffer, uint32_t width, uint32_t height, uint32_t depth) = 0;
+		virtual void Dispatch(const Ref<CommandBuffer>& commandBuffer, uint32_t width, uint32_t height, uint32_t depth) = 0;
 
 		static Ref<ComputeShader> Create(ShaderSpecification specs);
+		static Ref<ComputeShader> Create(ShaderBlob compute);
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include "swpch.h"
+#include "ShaderArchive.hpp"
+
+#include "Swift/Core/Logging.hpp"
+
+#if defined(APP_PLATFORM_WINDOWS)
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+namespace Swift
+{
+
+	ShaderArchive::ShaderArchive(const std::filesystem::path& path)
+	{
+		#if defined(APP_PLATFORM_WINDOWS)
+		HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			APP_LOG_ERROR("Failed to open shader archive '{0}'", path.string());
+			return;
+		}
+
+		LARGE_INTEGER size = {};
+		GetFileSizeEx(file, &size);
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+		if (!data)
+		{
+			APP_LOG_ERROR("Failed to map shader archive '{0}'", path.string());
+			if (mapping)
+				CloseHandle(mapping);
+			CloseHandle(file);
+			return;
+		}
+
+		m_File = file;
+		m_Mapping = mapping;
+		m_Size = (size_t)size.QuadPart;
+		#else
+		int file = open(path.c_str(), O_RDONLY);
+		if (file == -1)
+		{
+			APP_LOG_ERROR("Failed to open shader archive '{0}'", path.string());
+			return;
+		}
+
+		struct stat info = {};
+		fstat(file, &info);
+
+		void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+		close(file); // Note(Jorben): The mapping stays valid after closing the file
+
+		if (data == MAP_FAILED)
+		{
+			APP_LOG_ERROR("Failed to map shader archive '{0}'", path.string());
+			return;
+		}
+
+		m_Size = (size_t)info.st_size;
+		#endif
+
+		m_Data = static_cast<const uint8_t*>(data);
+
+		const ShaderArchiveHeader* header = reinterpret_cast<const ShaderArchiveHeader*>(m_Data);
+		if (m_Size < sizeof(ShaderArchiveHeader) || header->Magic != ShaderArchiveHeader::s_Magic || header->Version != ShaderArchiveHeader::s_Version
+			|| m_Size < sizeof(ShaderArchiveHeader) + header->EntryCount * sizeof(ShaderArchiveEntry))
+		{
+			APP_LOG_ERROR("Shader archive '{0}' is invalid or has an unsupported version.", path.string());
+			return;
+		}
+
+		m_Valid = true;
+	}
+
+	ShaderArchive::~ShaderArchive()
+	{
+		#if defined(APP_PLATFORM_WINDOWS)
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+		if (m_Mapping)
+			CloseHandle(m_Mapping);
+		if (m_File)
+			CloseHandle(m_File);
+		#else
+		if (m_Data)
+			munmap((void*)m_Data, m_Size);
+		#endif
+	}
+
+	ShaderBlob ShaderArchive::Get(const std::string& name, ShaderStage stage, const ShaderCompileOptions& options) const
+	{
+		if (!m_Valid)
+			return {};
+
+		const ShaderArchiveHeader* header = reinterpret_cast<const ShaderArchiveHeader*>(m_Data);
+		const ShaderArchiveEntry* begin = reinterpret_cast<const ShaderArchiveEntry*>(m_Data + sizeof(ShaderArchiveHeader));
+		const ShaderArchiveEntry* end = begin + header->EntryCount;
+
+		uint64_t key = GetKey(name, stage, options);
+		auto it = std::lower_bound(begin, end, key, [](const ShaderArchiveEntry& entry, uint64_t key) { return entry.Key < key; });
+
+		if (it == end || it->Key != key || it->Offset + it->Size > m_Size)
+			return {};
+
+		return { reinterpret_cast<const uint32_t*>(m_Data + it->Offset), (size_t)it->Size };
+	}
+
+	uint64_t ShaderArchive::GetKey(const std::string& name, ShaderStage stage, const ShaderCompileOptions& options)
+	{
+		uint64_t hash = Utils::ToolKit::Hash(name);
+		hash = Utils::ToolKit::Hash(&stage, sizeof(ShaderStage), hash);
+		return Utils::ToolKit::Hash(options.ToString(), hash);
+	}
+
+	bool ShaderArchive::Write(const std::filesystem::path& path, const std::vector<ShaderArchiveInput>& shaders)
+	{
+		ShaderArchiveHeader header = {};
+		header.EntryCount = (uint32_t)shaders.size();
+
+		std::vector<ShaderArchiveEntry> entries(shaders.size());
+
+		// Note(Jorben): Blobs are placed in input order, the table is sorted by key for lookups
+		uint64_t offset = sizeof(ShaderArchiveHeader) + shaders.size() * sizeof(ShaderArchiveEntry);
+		for (size_t i = 0; i < shaders.size(); i++)
+		{
+			offset = (offset + 3) & ~(uint64_t)3;
+
+			entries[i].Key = GetKey(shaders[i].Name, shaders[i].Stage, shaders[i].Options);
+			entries[i].Offset = offset;
+			entries[i].Size = shaders[i].Code.size();
+
+			offset += entries[i].Size;
+		}
+
+		std::vector<ShaderArchiveEntry> table = entries;
+		std::sort(table.begin(), table.end(), [](const ShaderArchiveEntry& a, const ShaderArchiveEntry& b) { return a.Key < b.Key; });
+
+		for (size_t i = 1; i < table.size(); i++)
+		{
+			if (table[i].Key == table[i - 1].Key)
+			{
+				APP_LOG_ERROR("Shader archive '{0}' contains duplicate shaders.", path.string());
+				return false;
+			}
+		}
+
+		std::ofstream file(path, std::ios::binary);
+		if (!file.is_open() || !file.good())
+		{
+			APP_LOG_ERROR("Failed to open '{0}'", path.string());
+			return false;
+		}
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(ShaderArchiveHeader));
+		file.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(ShaderArchiveEntry));
+
+		const char padding[4] = {};
+		for (size_t i = 0; i < shaders.size(); i++)
+		{
+			file.write(padding, entries[i].Offset - (uint64_t)file.tellp());
+			file.write(shaders[i].Code.data(), shaders[i].Code.size());
+		}
+
+		file.close();
+		return true;
+	}
+
+	Ref<ShaderArchive> ShaderArchive::Create(const std::filesystem::path& path)
+	{
+		return RefHelper::Create<ShaderArchive>(path);
+	}
+
+}
\ No newline at end of file
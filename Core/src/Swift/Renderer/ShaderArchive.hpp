@@ -0,0 +1,77 @@
+#pragma once
+
+#include <vector>
+#include <filesystem>
+
+#include "Swift/Core/Core.hpp"
+#include "Swift/Utils/Utils.hpp"
+
+#include "Swift/Renderer/Shader.hpp"
+
+namespace Swift
+{
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Specifications
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Note(Jorben): Layout on disk: Header, Entry[EntryCount] (sorted by key) and after that the 4 byte aligned SPIR-V blobs.
+	struct ShaderArchiveHeader
+	{
+	public:
+		inline static constexpr const uint32_t s_Magic = 0x41535753; // 'SWSA'
+		inline static constexpr const uint32_t s_Version = 1;
+
+		uint32_t Magic = s_Magic;
+		uint32_t Version = s_Version;
+		uint32_t EntryCount = 0;
+		uint32_t Reserved = 0;
+	};
+
+	struct ShaderArchiveEntry
+	{
+	public:
+		uint64_t Key = 0;
+		uint64_t Offset = 0; // From the start of the file
+		uint64_t Size = 0; // In bytes
+	};
+
+	struct ShaderArchiveInput
+	{
+	public:
+		std::string Name = {};
+		ShaderStage Stage = ShaderStage::None;
+		ShaderCompileOptions Options = {};
+
+		std::vector<char> Code = { };
+	};
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// ShaderArchive
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Note(Jorben): The archive is memory mapped, blobs point straight into the mapping so they are only valid while the archive is alive.
+	class ShaderArchive
+	{
+	public:
+		ShaderArchive(const std::filesystem::path& path);
+		virtual ~ShaderArchive();
+
+		// Note(Jorben): Returns an empty blob if the shader is not in the archive.
+		ShaderBlob Get(const std::string& name, ShaderStage stage, const ShaderCompileOptions& options = {}) const;
+
+		inline bool Valid() const { return m_Valid; }
+
+		static uint64_t GetKey(const std::string& name, ShaderStage stage, const ShaderCompileOptions& options);
+		static bool Write(const std::filesystem::path& path, const std::vector<ShaderArchiveInput>& shaders);
+
+		static Ref<ShaderArchive> Create(const std::filesystem::path& path);
+
+	private:
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+		bool m_Valid = false;
+
+		void* m_File = nullptr; // Note(Jorben): Only used on Windows
+		void* m_Mapping = nullptr; // Note(Jorben): Only used on Windows
+	};
+
+}
\ No newline at end of file
@@ -1,9 +1,10 @@
 #pragma once
 
-#ifdef APP_PLATFORM_WINDOWS
 #include <tracy/Tracy.hpp>
 #include <tracy/TracyC.h>
 
+#include "Swift/Utils/Tracer.hpp"
+
 #include <new>
 #include <cstdlib>
 
@@ -11,10 +12,26 @@
 #define APP_ENABLE_PROFILING 1
 #define APP_MEM_PROFILING 0
 
-#if !defined(APP_DIST) && APP_ENABLE_PROFILING
+// Note(Jorben): The built-in Chrome trace exporter (see Utils/Tracer.hpp), a separate option that replaces Tracy when enabled,
+// so a scope only pays for the tracer. Can be turned on from the build with APP_ENABLE_TRACING=1.
+#if !defined(APP_ENABLE_TRACING)
+	#define APP_ENABLE_TRACING 0
+#endif
+
+#define APP_TRACE_CONCAT_INTERNAL(a, b) a##b
+#define APP_TRACE_CONCAT(a, b) APP_TRACE_CONCAT_INTERNAL(a, b)
+
+#if !defined(APP_DIST) && APP_ENABLE_TRACING
+
+#define APP_MARK_FRAME ::Swift::Utils::Tracer::MarkFrame()
+#define APP_PROFILE_SCOPE(name) ::Swift::Utils::TraceScope APP_TRACE_CONCAT(traceScope, __LINE__)(name)
+#define APP_PROFILE_THREAD(name) ::Swift::Utils::Tracer::SetThreadName(name)
+
+#elif !defined(APP_DIST) && APP_ENABLE_PROFILING
 
 #define APP_MARK_FRAME FrameMark
 #define APP_PROFILE_SCOPE(name) ZoneScopedN(name)
+#define APP_PROFILE_THREAD(name) tracy::SetThreadName(name)
 
 #if APP_MEM_PROFILING
 void* operator new(size_t size);
@@ -25,7 +42,7 @@ void operator delete(void* ptr, size_t size) noexcept;
 #else
 
 #define APP_MARK_FRAME
-#define APP_PROFILE_SCOPE
+#define APP_PROFILE_SCOPE(name)
+#define APP_PROFILE_THREAD(name)
 
-#endif
 #endif
\ No newline at end of file
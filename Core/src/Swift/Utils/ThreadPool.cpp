@@ -0,0 +1,101 @@
+#include "swpch.h"
+#include "ThreadPool.hpp"
+
+#include "Swift/Utils/Profiler.hpp"
+
+namespace Swift::Utils
+{
+
+	ThreadPool::ThreadPool(uint32_t workers)
+	{
+		m_Workers.reserve((size_t)workers);
+		for (uint32_t i = 0; i < workers; i++)
+			m_Workers.emplace_back(&ThreadPool::Loop, this);
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::scoped_lock<std::mutex> lock(m_Mutex);
+			m_Running = false;
+		}
+		m_WorkCondition.notify_all();
+
+		for (auto& worker : m_Workers)
+			worker.join();
+	}
+
+	void ThreadPool::Dispatch(size_t count, const Job& job)
+	{
+		if (count == 0)
+			return;
+
+		{
+			// Note(Jorben): A worker that woke up late for the previous dispatch might still be looking for work
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_DoneCondition.wait(lock, [this]() { return m_Busy == 0; });
+
+			m_Job = &job;
+			m_Count = count;
+			m_Next = 0;
+			m_Remaining = count;
+			m_Generation++;
+		}
+		m_WorkCondition.notify_all();
+
+		// Note(Jorben): The calling thread also takes jobs
+		Work();
+
+		std::unique_lock<std::mutex> lock(m_Mutex);
+		m_DoneCondition.wait(lock, [this]() { return m_Remaining.load() == 0 && m_Busy == 0; });
+		m_Job = nullptr;
+	}
+
+	void ThreadPool::Loop()
+	{
+		APP_PROFILE_THREAD("Worker Thread");
+
+		uint64_t generation = 0;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				m_WorkCondition.wait(lock, [this, generation]() { return m_Generation != generation || !m_Running; });
+
+				if (!m_Running)
+					break;
+
+				generation = m_Generation;
+				m_Busy++;
+			}
+
+			Work();
+
+			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
+				m_Busy--;
+			}
+			m_DoneCondition.notify_all();
+		}
+	}
+
+	void ThreadPool::Work()
+	{
+		while (true)
+		{
+			size_t index = m_Next.fetch_add(1);
+			if (index >= m_Count)
+				break;
+
+			(*m_Job)(index);
+
+			// Note(Jorben): The last job wakes up the dispatching thread
+			if (m_Remaining.fetch_sub(1) == 1)
+			{
+				std::scoped_lock<std::mutex> lock(m_Mutex);
+				m_DoneCondition.notify_all();
+			}
+		}
+	}
+
+}
\ No newline at end of file
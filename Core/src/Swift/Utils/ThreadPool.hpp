@@ -0,0 +1,52 @@
+#pragma once
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <functional>
+#include <condition_variable>
+
+namespace Swift::Utils
+{
+
+	// Note(Jorben): A fixed set of worker threads for fork/join work that happens every frame (like parallel layer updates),
+	// creating a thread per job (std::async) costs more than most of these jobs take.
+	class ThreadPool
+	{
+	public:
+		typedef std::function<void(size_t)> Job;
+
+	public:
+		ThreadPool(uint32_t workers);
+		virtual ~ThreadPool();
+
+		// Note(Jorben): Runs job(0) to job(count - 1) spread over the workers and the calling thread, returns once all of them are done.
+		// Only one Dispatch can be in flight at a time.
+		void Dispatch(size_t count, const Job& job);
+
+		inline uint32_t GetWorkerCount() const { return (uint32_t)m_Workers.size(); }
+
+	private:
+		void Loop();
+		void Work();
+
+	private:
+		std::vector<std::thread> m_Workers = { };
+
+		std::mutex m_Mutex = {};
+		std::condition_variable m_WorkCondition = {};
+		std::condition_variable m_DoneCondition = {};
+		bool m_Running = true;
+
+		// Note(Jorben): Describes the current dispatch, only changed when no worker is inside Work()
+		uint32_t m_Busy = 0;
+		const Job* m_Job = nullptr;
+		size_t m_Count = 0;
+		uint64_t m_Generation = 0;
+		std::atomic<size_t> m_Next = 0;
+		std::atomic<size_t> m_Remaining = 0;
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,346 @@
+#include "swpch.h"
+#include "Tracer.hpp"
+
+#include "Swift/Core/Logging.hpp"
+
+#include <array>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include <future>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+
+namespace Swift::Utils
+{
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Buffers
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Note(Jorben): Only the owning thread writes to a buffer. Events are published by the release store of Count,
+	// chunks get allocated on demand and are never freed, so a reader never sees memory disappear.
+	struct ThreadBuffer
+	{
+	public:
+		inline static constexpr const size_t ChunkSize = 4096;
+		inline static constexpr const size_t MaxChunks = 256; // Note(Jorben): ~1M events per thread per capture, the rest gets dropped
+
+		std::array<std::atomic<TraceEvent*>, MaxChunks> Chunks = { };
+		std::atomic<uint64_t> Count = 0;
+		std::atomic<uint64_t> Generation = 0; // Note(Jorben): The capture the events belong to, older events are reset lazily by the owner
+
+		uint32_t Thread = 0;
+		bool InUse = false;
+	};
+
+	// Note(Jorben): Threads come and go (std::async), so buffers get handed back on thread exit and reused by the next thread.
+	struct ThreadBufferHandle
+	{
+	public:
+		ThreadBuffer* Buffer = nullptr;
+
+		~ThreadBufferHandle();
+	};
+
+	static std::mutex s_RegistryMutex = {};
+	static std::vector<std::unique_ptr<ThreadBuffer>> s_Buffers = { };
+	static std::unordered_map<uint32_t, std::string> s_ThreadNames = { };
+	static uint32_t s_NextThread = 1;
+
+	// Note(Jorben): Only touched by the slow path, the hot path uses Tracer::s_Writer which doesn't need a thread_local initialization guard.
+	static thread_local ThreadBufferHandle s_Handle = {};
+
+	static std::atomic<uint64_t> s_Dropped = 0;
+	static std::atomic<uint32_t> s_FramesLeft = 0;
+	static std::filesystem::path s_CapturePath = {};
+
+	// Note(Jorben): Used to convert ticks to microseconds when dumping
+	static uint64_t s_StartTicks = 0;
+	static std::chrono::steady_clock::time_point s_StartTime = {};
+	static uint64_t s_StopTicks = 0;
+	static std::chrono::steady_clock::time_point s_StopTime = {};
+
+	static std::future<bool> s_PendingDump = {};
+
+	static const char s_FrameEventName[] = "Frame";
+
+	static ThreadBuffer* AcquireBuffer()
+	{
+		std::scoped_lock<std::mutex> lock(s_RegistryMutex);
+
+		ThreadBuffer* buffer = nullptr;
+		for (auto& b : s_Buffers)
+		{
+			if (!b->InUse)
+			{
+				buffer = b.get();
+				break;
+			}
+		}
+
+		if (!buffer)
+		{
+			s_Buffers.push_back(std::make_unique<ThreadBuffer>());
+			buffer = s_Buffers.back().get();
+		}
+
+		buffer->InUse = true;
+		buffer->Thread = s_NextThread++;
+		return buffer;
+	}
+
+	static ThreadBuffer* GetBuffer()
+	{
+		if (!s_Handle.Buffer)
+			s_Handle.Buffer = AcquireBuffer();
+
+		return s_Handle.Buffer;
+	}
+
+	static void WaitForDump()
+	{
+		if (s_PendingDump.valid())
+			s_PendingDump.get();
+	}
+
+	static void AppendEscaped(std::string& out, const char* str)
+	{
+		for (; *str; str++)
+		{
+			if (*str == '"' || *str == '\\')
+				out += '\\';
+			out += *str;
+		}
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Tracer
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	std::atomic<bool> Tracer::s_Recording = false;
+	std::atomic<uint64_t> Tracer::s_Generation = 0;
+
+	ThreadBufferHandle::~ThreadBufferHandle()
+	{
+		if (!Buffer)
+			return;
+
+		std::scoped_lock<std::mutex> lock(s_RegistryMutex);
+		Buffer->InUse = false;
+		Buffer = nullptr;
+		Tracer::s_Writer = {};
+	}
+
+	void Tracer::Start()
+	{
+		if (Recording())
+			return;
+
+		// Note(Jorben): A dump that is still being written reads the buffers we're about to reset
+		WaitForDump();
+
+		s_Dropped.store(0, std::memory_order_relaxed);
+		s_Generation.fetch_add(1, std::memory_order_release);
+
+		s_StartTime = std::chrono::steady_clock::now();
+		s_StartTicks = Now();
+
+		s_Recording.store(true, std::memory_order_release);
+	}
+
+	void Tracer::Stop()
+	{
+		if (Recording())
+		{
+			s_StopTime = std::chrono::steady_clock::now();
+			s_StopTicks = Now();
+		}
+
+		s_Recording.store(false, std::memory_order_release);
+		s_FramesLeft.store(0, std::memory_order_relaxed);
+	}
+
+	void Tracer::Capture(uint32_t frames, const std::filesystem::path& path)
+	{
+		Stop();
+
+		s_CapturePath = path;
+		s_FramesLeft.store(frames, std::memory_order_relaxed);
+
+		Start();
+	}
+
+	bool Tracer::Dump(const std::filesystem::path& path)
+	{
+		WaitForDump();
+		return WriteTrace(path);
+	}
+
+	void Tracer::DumpAsync(const std::filesystem::path& path)
+	{
+		WaitForDump();
+		s_PendingDump = std::async(std::launch::async, [path]() { return WriteTrace(path); });
+	}
+
+	void Tracer::MarkFrame()
+	{
+		if (!Recording())
+			return;
+
+		uint64_t now = Now();
+		Record(s_FrameEventName, now, now);
+
+		uint32_t framesLeft = s_FramesLeft.load(std::memory_order_relaxed);
+		if (framesLeft == 0)
+			return;
+
+		s_FramesLeft.store(framesLeft - 1, std::memory_order_relaxed);
+		if (framesLeft == 1)
+		{
+			Stop();
+
+			// Note(Jorben): Formatting & writing the JSON takes multiple frames worth of time on bigger captures
+			DumpAsync(s_CapturePath);
+		}
+	}
+
+	void Tracer::SetThreadName(const std::string& name)
+	{
+		ThreadBuffer* buffer = GetBuffer();
+
+		std::scoped_lock<std::mutex> lock(s_RegistryMutex);
+		s_ThreadNames[buffer->Thread] = name;
+	}
+
+	void Tracer::RecordSlow(const char* name, uint64_t start, uint64_t end)
+	{
+		TraceWriter& writer = s_Writer;
+
+		// Note(Jorben): First event on this thread, a reused buffer continues where its previous thread left off
+		if (!writer.Count)
+		{
+			ThreadBuffer* buffer = GetBuffer();
+
+			writer.Count = &buffer->Count;
+			writer.Index = buffer->Count.load(std::memory_order_relaxed);
+			writer.Generation = buffer->Generation.load(std::memory_order_relaxed);
+			writer.Thread = buffer->Thread;
+		}
+
+		ThreadBuffer* buffer = s_Handle.Buffer;
+
+		uint64_t generation = s_Generation.load(std::memory_order_relaxed);
+		if (writer.Generation != generation)
+		{
+			buffer->Count.store(0, std::memory_order_relaxed);
+			buffer->Generation.store(generation, std::memory_order_release);
+
+			writer.Generation = generation;
+			writer.Index = 0;
+		}
+
+		size_t chunk = (size_t)(writer.Index / ThreadBuffer::ChunkSize);
+		if (chunk >= ThreadBuffer::MaxChunks)
+		{
+			writer.Cursor = writer.End = nullptr;
+			s_Dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		TraceEvent* events = buffer->Chunks[chunk].load(std::memory_order_relaxed);
+		if (!events)
+		{
+			// Note(Jorben): Uninitialized on purpose, every slot gets written before Count publishes it
+			events = (TraceEvent*)::operator new(sizeof(TraceEvent) * ThreadBuffer::ChunkSize);
+			buffer->Chunks[chunk].store(events, std::memory_order_release);
+		}
+
+		writer.Cursor = events + (writer.Index % ThreadBuffer::ChunkSize);
+		writer.End = events + ThreadBuffer::ChunkSize;
+
+		*writer.Cursor++ = { name, start, end, writer.Thread };
+		writer.Count->store(++writer.Index, std::memory_order_release);
+	}
+
+	bool Tracer::WriteTrace(const std::filesystem::path& path)
+	{
+		// Note(Jorben): Calibrate the ticks against the steady clock over the whole capture
+		double ticksPerMicrosecond = 1000.0;
+		#if APP_TRACE_TSC
+		{
+			uint64_t ticks = (Recording() ? Now() : s_StopTicks) - s_StartTicks;
+			auto time = (Recording() ? std::chrono::steady_clock::now() : s_StopTime);
+			double microseconds = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(time - s_StartTime).count() / 1000.0;
+			ticksPerMicrosecond = (microseconds > 0.0 ? (double)ticks / microseconds : 1.0);
+		}
+		#endif
+
+		std::string out = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+		out += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"Swift\"}}";
+
+		uint64_t generation = s_Generation.load(std::memory_order_acquire);
+		uint64_t events = 0;
+		{
+			std::scoped_lock<std::mutex> lock(s_RegistryMutex);
+
+			for (auto& [thread, name] : s_ThreadNames)
+			{
+				out += fmt::format(",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":\"", thread);
+				AppendEscaped(out, name.c_str());
+				out += "\"}}";
+			}
+
+			for (auto& buffer : s_Buffers)
+			{
+				if (buffer->Generation.load(std::memory_order_acquire) != generation)
+					continue;
+
+				uint64_t count = buffer->Count.load(std::memory_order_acquire);
+				for (uint64_t i = 0; i < count; i++)
+				{
+					const TraceEvent& event = buffer->Chunks[i / ThreadBuffer::ChunkSize].load(std::memory_order_acquire)[i % ThreadBuffer::ChunkSize];
+
+					// Note(Jorben): Scopes that were started before the capture
+					if (event.Start < s_StartTicks)
+						continue;
+
+					double timestamp = (double)(event.Start - s_StartTicks) / ticksPerMicrosecond;
+
+					out += ",\n{\"name\":\"";
+					AppendEscaped(out, event.Name);
+
+					if (event.Name == s_FrameEventName)
+					{
+						fmt::format_to(std::back_inserter(out), "\",\"ph\":\"i\",\"s\":\"g\",\"ts\":{0:.3f},\"pid\":1,\"tid\":{1}}}", timestamp, event.Thread);
+					}
+					else
+					{
+						double duration = (double)(event.End - event.Start) / ticksPerMicrosecond;
+						fmt::format_to(std::back_inserter(out), "\",\"ph\":\"X\",\"ts\":{0:.3f},\"dur\":{1:.3f},\"pid\":1,\"tid\":{2}}}", timestamp, duration, event.Thread);
+					}
+
+					events++;
+				}
+			}
+		}
+
+		out += "\n]}\n";
+
+		std::ofstream file(path, std::ios::binary);
+		if (!file.is_open())
+		{
+			APP_LOG_ERROR("Failed to open trace file: '{0}'", path.string());
+			return false;
+		}
+
+		file.write(out.data(), (std::streamsize)out.size());
+
+		uint64_t dropped = s_Dropped.load(std::memory_order_relaxed);
+		if (dropped)
+			APP_LOG_WARN("Trace buffers were full, {0} events were dropped.", dropped);
+
+		APP_LOG_INFO("Wrote {0} trace events to '{1}'", events, path.string());
+		return true;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <filesystem>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	#include <intrin.h>
+	#define APP_TRACE_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+	#define APP_TRACE_TSC 1
+#else
+	#define APP_TRACE_TSC 0
+#endif
+
+namespace Swift::Utils
+{
+
+	struct ThreadBufferHandle;
+
+	struct TraceEvent
+	{
+	public:
+		const char* Name = nullptr;
+		uint64_t Start = 0;
+		uint64_t End = 0;
+		uint32_t Thread = 0;
+	};
+
+	// Note(Jorben): The recording thread's position in its own buffer, so the common case is a store and a bump.
+	struct TraceWriter
+	{
+	public:
+		TraceEvent* Cursor = nullptr;
+		TraceEvent* End = nullptr; // Note(Jorben): End of the current chunk
+
+		std::atomic<uint64_t>* Count = nullptr; // Note(Jorben): Published event count of the thread's buffer, nullptr until a buffer is acquired
+		uint64_t Index = 0;
+		uint64_t Generation = 0;
+		uint32_t Thread = 0;
+	};
+
+	// Note(Jorben): A built-in alternative to Tracy that doesn't need a connected GUI, which is what headless machines need.
+	// Enabled with APP_ENABLE_TRACING (see Utils/Profiler.hpp), then every APP_PROFILE_SCOPE records one event into a buffer
+	// owned by its thread (no locks), but only while a capture is running.
+	// The result is written as Chrome Trace Event JSON, which can be opened in ui.perfetto.dev or chrome://tracing.
+	//
+	// Start/Stop/Capture/Dump are meant to be called from one thread (the main thread), recording can happen on any thread.
+	class Tracer
+	{
+	public:
+		// Note(Jorben): Clears whatever was recorded before (waits for a dump that is still being written).
+		static void Start();
+		static void Stop();
+
+		// Note(Jorben): Starts recording and after the amount of frames stops & writes the file on a background thread.
+		static void Capture(uint32_t frames, const std::filesystem::path& path = "trace.json");
+		static bool Dump(const std::filesystem::path& path = "trace.json");
+		// Note(Jorben): Same as Dump, but the file gets written on a background thread.
+		static void DumpAsync(const std::filesystem::path& path = "trace.json");
+
+		// Note(Jorben): Called through APP_MARK_FRAME, adds a frame marker to the timeline & counts down Capture().
+		static void MarkFrame();
+		static void SetThreadName(const std::string& name);
+
+		inline static bool Recording() { return s_Recording.load(std::memory_order_relaxed); }
+
+		// Note(Jorben): Raw ticks, the TSC where available (assumes an invariant TSC, like every modern x86 CPU has).
+		inline static uint64_t Now()
+		{
+		#if APP_TRACE_TSC
+			return __rdtsc();
+		#else
+			return (uint64_t)std::chrono::steady_clock::now().time_since_epoch().count();
+		#endif
+		}
+
+		inline static void Record(const char* name, uint64_t start, uint64_t end)
+		{
+			TraceWriter& writer = s_Writer;
+			if (writer.Cursor != writer.End && writer.Generation == s_Generation.load(std::memory_order_relaxed)) [[likely]]
+			{
+				*writer.Cursor++ = { name, start, end, writer.Thread };
+				writer.Count->store(++writer.Index, std::memory_order_release);
+				return;
+			}
+
+			RecordSlow(name, start, end);
+		}
+
+	private:
+		// Note(Jorben): Acquires a buffer, starts a new chunk or resets the buffer for a new capture.
+		static void RecordSlow(const char* name, uint64_t start, uint64_t end);
+		static bool WriteTrace(const std::filesystem::path& path);
+
+	private:
+		static std::atomic<bool> s_Recording;
+		static std::atomic<uint64_t> s_Generation; // Note(Jorben): Incremented by every Start(), older events are reset lazily by their thread
+
+		inline static thread_local TraceWriter s_Writer = {};
+
+		friend struct ThreadBufferHandle;
+	};
+
+	// Note(Jorben): The name has to outlive the capture, like a string literal.
+	class TraceScope
+	{
+	public:
+		inline TraceScope(const char* name)
+			: m_Name(name), m_Start(Tracer::Recording() ? Tracer::Now() : 0)
+		{
+		}
+		inline ~TraceScope()
+		{
+			if (m_Start)
+				Tracer::Record(m_Name, m_Start, Tracer::Now());
+		}
+
+	private:
+		const char* m_Name;
+		uint64_t m_Start;
+	};
+
+}
\ No newline at end of file
@@ -66,6 +66,8 @@ namespace Swift::Utils
         static std::string OpenDirectory(const std::string& dir = "") { return s_Instance ? s_Instance->OpenDirectoryImpl(dir) : ""; }
 
         static double GetTime() { return s_Instance ? s_Instance->GetTimeImpl() : 0.0f; }
+        // Note(Jorben): Monotonic time in nanoseconds, use this for timing short spans of code.
+        static uint64_t GetTimeNanoseconds() { return s_Instance ? s_Instance->GetTimeNanosecondsImpl() : 0; }
 
         // Non-Platform specific
         inline static void Sleep(uint32_t miliseconds)
@@ -78,6 +80,26 @@ namespace Swift::Utils
             std::replace(str.begin(), str.end(), replace, with);
         }
 
+        // Note(Jorben): 64-bit FNV-1a, pass in the previous result as seed to combine hashes.
+        inline static uint64_t Hash(const void* data, size_t size, uint64_t seed = 14695981039346656037ull)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+            uint64_t hash = seed;
+            for (size_t i = 0; i < size; i++)
+            {
+                hash ^= bytes[i];
+                hash *= 1099511628211ull;
+            }
+
+            return hash;
+        }
+
+        inline static uint64_t Hash(const std::string& str, uint64_t seed = 14695981039346656037ull)
+        {
+            return Hash(str.data(), str.size(), seed);
+        }
+
     private:
         virtual std::string OpenFileImpl(const std::string& filter, const std::string& dir) const = 0;
         virtual std::string SaveFileImpl(const std::string& filter, const std::string& dir) const = 0;
@@ -85,6 +107,7 @@ namespace Swift::Utils
         virtual std::string OpenDirectoryImpl(const std::string& dir) const = 0;
 
         virtual double GetTimeImpl() const = 0;
+        virtual uint64_t GetTimeNanosecondsImpl() const = 0;
 
     private:
         static std::unique_ptr<ToolKit> s_Instance;
@@ -189,7 +212,7 @@ namespace Swift::Utils
 
 
     private:
-        std::mutex m_Mutex = {};
+        mutable std::mutex m_Mutex = {};
         std::queue<Func> m_Queue = { };
     };
 
@@ -29,6 +29,7 @@ namespace Swift
 		allocator.MapMemory(stagingBufferAllocation, mappedData);
 		memcpy(mappedData, data, m_BufferSize);
 		allocator.UnMapMemory(stagingBufferAllocation);
+		Renderer::GetCurrentRenderData().UploadedBytes += m_BufferSize;
 
 		allocator.CopyBuffer(stagingBuffer, m_Buffer, m_BufferSize);
 		allocator.DestroyBuffer(stagingBuffer, stagingBufferAllocation);
@@ -48,12 +49,10 @@ namespace Swift
 		});
 	}
 
-	void VulkanVertexBuffer::Bind(Ref<CommandBuffer> commandBuffer)
+	void VulkanVertexBuffer::Bind(const Ref<CommandBuffer>& commandBuffer)
 	{
-		auto cmdBuf = RefHelper::RefAs<VulkanCommandBuffer>(commandBuffer);
-		
-		VkDeviceSize offsets[] = { 0 };
-		vkCmdBindVertexBuffers(cmdBuf->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()), 0, 1, &m_Buffer, offsets);
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+		cmdBuf->BindVertexBuffer(m_Buffer);
 	}
 
 
@@ -74,6 +73,7 @@ namespace Swift
 		allocator.MapMemory(stagingBufferAllocation, mappedData);
 		memcpy(mappedData, indices, bufferSize);
 		allocator.UnMapMemory(stagingBufferAllocation);
+		Renderer::GetCurrentRenderData().UploadedBytes += bufferSize;
 
 		allocator.CopyBuffer(stagingBuffer, m_Buffer, bufferSize);
 		allocator.DestroyBuffer(stagingBuffer, stagingBufferAllocation);
@@ -93,11 +93,10 @@ namespace Swift
 		});
 	}
 
-	void VulkanIndexBuffer::Bind(Ref<CommandBuffer> commandBuffer) const
+	void VulkanIndexBuffer::Bind(const Ref<CommandBuffer>& commandBuffer) const
 	{
-		auto cmdBuf = RefHelper::RefAs<VulkanCommandBuffer>(commandBuffer);
-
-		vkCmdBindIndexBuffer(cmdBuf->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()), m_Buffer, 0, VK_INDEX_TYPE_UINT32);
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+		cmdBuf->BindIndexBuffer(m_Buffer, VK_INDEX_TYPE_UINT32);
 	}
 
 
@@ -150,13 +149,15 @@ namespace Swift
 			memcpy(static_cast<uint8_t*>(mappedMemory) + offset, data, size);
 			VulkanAllocator::UnMapMemory(m_Allocations[i]);
 		}
+
+		Renderer::GetCurrentRenderData().UploadedBytes += size * framesInFlight;
 	}
 
-	void VulkanUniformBuffer::Upload(Ref<DescriptorSet> set, Descriptor element)
+	void VulkanUniformBuffer::Upload(const Ref<DescriptorSet>& set, Descriptor element)
 	{
 		APP_PROFILE_SCOPE("VulkanUniformBuffer::Upload");
 
-		auto vkSet = RefHelper::RefAs<VulkanDescriptorSet>(set);
+		auto vkSet = RefHelper::RawAs<VulkanDescriptorSet>(set);
 
 		constexpr const size_t framesInFlight = (size_t)RendererSpecification::BufferCount;
 		for (size_t i = 0; i < framesInFlight; i++)
@@ -166,16 +167,7 @@ namespace Swift
 			bufferInfo.offset = 0;
 			bufferInfo.range = m_Size;
 
-			VkWriteDescriptorSet descriptorWrite = {};
-			descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-			descriptorWrite.dstSet = vkSet->GetVulkanSet((uint32_t)i);
-			descriptorWrite.dstBinding = element.Binding;
-			descriptorWrite.dstArrayElement = 0;
-			descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-			descriptorWrite.descriptorCount = element.Count;
-			descriptorWrite.pBufferInfo = &bufferInfo;
-
-			vkUpdateDescriptorSets(((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice(), 1, &descriptorWrite, 0, nullptr);
+			vkSet->GetWriter((uint32_t)i).WriteBuffer(element.Binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, bufferInfo, m_ResourceID);
 		}
 	}
 
@@ -234,6 +226,8 @@ namespace Swift
 			memcpy(mappedMemory, data, size);
 			VulkanAllocator::UnMapMemory(m_Allocations[i]);
 		}
+
+		Renderer::GetCurrentRenderData().UploadedBytes += size * framesInFlight;
 	}
 
 	void VulkanDynamicUniformBuffer::SetDataIndexed(uint32_t index, void* data, size_t size)
@@ -246,6 +240,7 @@ namespace Swift
 		APP_PROFILE_SCOPE("VulkanDynamicUniformBuffer::UploadIndexedData");
 
 		constexpr const size_t framesInFlight = (size_t)RendererSpecification::BufferCount;
+		size_t uploaded = 0;
 		for (size_t i = 0; i < framesInFlight; i++)
 		{
 			void* mappedMemory = nullptr;
@@ -257,20 +252,23 @@ namespace Swift
 				size_t srcSize = m_IndexedData[j].second;
 				size_t copySize = std::min(srcSize, m_AlignmentOfOneElement); // Ensure not to copy more than the aligned size
 				memcpy(static_cast<char*>(mappedMemory) + j * m_AlignmentOfOneElement, srcData, copySize);
+				uploaded += copySize;
 			}
 
 			VulkanAllocator::UnMapMemory(m_Allocations[i]);
 		}
 
+		Renderer::GetCurrentRenderData().UploadedBytes += uploaded;
+
 		m_IndexedData.clear();
 		m_IndexedData.resize(m_ElementCount);
 	}
 
-	void VulkanDynamicUniformBuffer::Upload(Ref<DescriptorSet> set, Descriptor element)
+	void VulkanDynamicUniformBuffer::Upload(const Ref<DescriptorSet>& set, Descriptor element)
 	{
 		APP_PROFILE_SCOPE("VulkanUniformBuffer::Upload");
 
-		auto vkSet = RefHelper::RefAs<VulkanDescriptorSet>(set);
+		auto vkSet = RefHelper::RawAs<VulkanDescriptorSet>(set);
 
 		constexpr const size_t framesInFlight = (size_t)RendererSpecification::BufferCount;
 		for (size_t i = 0; i < framesInFlight; i++)
@@ -280,24 +278,15 @@ namespace Swift
 			bufferInfo.offset = 0;
 			bufferInfo.range = m_ElementCount * m_AlignmentOfOneElement;
 
-			VkWriteDescriptorSet descriptorWrite = {};
-			descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-			descriptorWrite.dstSet = vkSet->GetVulkanSet((uint32_t)i);
-			descriptorWrite.dstBinding = element.Binding;
-			descriptorWrite.dstArrayElement = 0;
-			descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-			descriptorWrite.descriptorCount = element.Count;
-			descriptorWrite.pBufferInfo = &bufferInfo;
-
-			vkUpdateDescriptorSets(((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice(), 1, &descriptorWrite, 0, nullptr);
+			vkSet->GetWriter((uint32_t)i).WriteBuffer(element.Binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, bufferInfo, m_ResourceID);
 		}
 	}
 
-	void VulkanDynamicUniformBuffer::Upload(Ref<DescriptorSet> set, Descriptor element, size_t offset)
+	void VulkanDynamicUniformBuffer::Upload(const Ref<DescriptorSet>& set, Descriptor element, size_t offset)
 	{
 		APP_PROFILE_SCOPE("VulkanUniformBuffer::Upload");
 
-		auto vkSet = RefHelper::RefAs<VulkanDescriptorSet>(set);
+		auto vkSet = RefHelper::RawAs<VulkanDescriptorSet>(set);
 
 		constexpr const size_t framesInFlight = (size_t)RendererSpecification::BufferCount;
 		for (size_t i = 0; i < framesInFlight; i++)
@@ -307,16 +296,7 @@ namespace Swift
 			bufferInfo.offset = offset;
 			bufferInfo.range = m_AlignmentOfOneElement;
 
-			VkWriteDescriptorSet descriptorWrite = {};
-			descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-			descriptorWrite.dstSet = vkSet->GetVulkanSet((uint32_t)i);
-			descriptorWrite.dstBinding = element.Binding;
-			descriptorWrite.dstArrayElement = 0;
-			descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
-			descriptorWrite.descriptorCount = element.Count;
-			descriptorWrite.pBufferInfo = &bufferInfo;
-
-			vkUpdateDescriptorSets(((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice(), 1, &descriptorWrite, 0, nullptr);
+			vkSet->GetWriter((uint32_t)i).WriteBuffer(element.Binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, bufferInfo, m_ResourceID);
 		}
 	}
 
@@ -370,6 +350,8 @@ namespace Swift
 			memcpy(static_cast<uint8_t*>(mappedMemory) + offset, data, size);
 			VulkanAllocator::UnMapMemory(m_Allocations[i]);
 		}
+
+		Renderer::GetCurrentRenderData().UploadedBytes += size * framesInFlight;
 	}
 
 	void* VulkanStorageBuffer::StartRetrieval()
@@ -385,11 +367,11 @@ namespace Swift
 		VulkanAllocator::UnMapMemory(m_Allocations[Renderer::GetCurrentFrame()]);
 	}
 
-	void VulkanStorageBuffer::Upload(Ref<DescriptorSet> set, Descriptor element)
+	void VulkanStorageBuffer::Upload(const Ref<DescriptorSet>& set, Descriptor element)
 	{
 		APP_PROFILE_SCOPE("VulkanStorageBuffer::Upload");
 
-		auto vkSet = RefHelper::RefAs<VulkanDescriptorSet>(set);
+		auto vkSet = RefHelper::RawAs<VulkanDescriptorSet>(set);
 
 		constexpr const size_t framesInFlight = (size_t)RendererSpecification::BufferCount;
 		for (size_t i = 0; i < framesInFlight; i++)
@@ -399,16 +381,7 @@ namespace Swift
 			bufferInfo.offset = 0;
 			bufferInfo.range = m_Size;
 
-			VkWriteDescriptorSet descriptorWrite = {};
-			descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-			descriptorWrite.dstSet = vkSet->GetVulkanSet((uint32_t)i);
-			descriptorWrite.dstBinding = element.Binding;
-			descriptorWrite.dstArrayElement = 0;
-			descriptorWrite.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-			descriptorWrite.descriptorCount = element.Count;
-			descriptorWrite.pBufferInfo = &bufferInfo;
-
-			vkUpdateDescriptorSets(((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice(), 1, &descriptorWrite, 0, nullptr);
+			vkSet->GetWriter((uint32_t)i).WriteBuffer(element.Binding, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bufferInfo, m_ResourceID);
 		}
 	}
 
@@ -6,6 +6,8 @@
 #include "Swift/Renderer/Buffers.hpp"
 #include "Swift/Renderer/Descriptors.hpp"
 
+#include "Swift/Vulkan/VulkanDescriptorWriter.hpp"
+
 #include <vulkan/vulkan.h>
 #include <vk_mem_alloc.h>
 
@@ -14,13 +16,15 @@ namespace Swift
 
 	// TODO: Add specifications (CPU/GPU, etc...)
 
-	class VulkanVertexBuffer : public VertexBuffer
+	class VulkanVertexBuffer final : public VertexBuffer
 	{
 	public:
 		VulkanVertexBuffer(void* data, size_t size);
 		virtual ~VulkanVertexBuffer();
 
-		void Bind(Ref<CommandBuffer> commandBuffer) override;
+		void Bind(const Ref<CommandBuffer>& commandBuffer) override;
+
+		inline VkBuffer GetVulkanBuffer() const { return m_Buffer; }
 
 	private:
 		VkBuffer m_Buffer = VK_NULL_HANDLE;
@@ -29,15 +33,16 @@ namespace Swift
 		size_t m_BufferSize = 0;
 	};
 
-	class VulkanIndexBuffer : public IndexBuffer
+	class VulkanIndexBuffer final : public IndexBuffer
 	{
 	public:
 		VulkanIndexBuffer(uint32_t* indices, uint32_t count);
 		virtual ~VulkanIndexBuffer();
 
-		void Bind(Ref<CommandBuffer> commandBuffer) const;
+		void Bind(const Ref<CommandBuffer>& commandBuffer) const;
 
 		inline uint32_t GetCount() const override { return m_Count; }
+		inline VkBuffer GetVulkanBuffer() const { return m_Buffer; }
 
 	private:
 		VkBuffer m_Buffer = VK_NULL_HANDLE;
@@ -46,7 +51,7 @@ namespace Swift
 		uint32_t m_Count = 0;
 	};
 
-	class VulkanUniformBuffer : public UniformBuffer
+	class VulkanUniformBuffer final : public UniformBuffer
 	{
 	public:
 		VulkanUniformBuffer(size_t dataSize);
@@ -54,16 +59,18 @@ namespace Swift
 
 		void SetData(void* data, size_t size, size_t offset) override;
 
-		void Upload(Ref<DescriptorSet> set, Descriptor element) override;
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element) override;
 
 	private:
 		std::vector<VkBuffer> m_Buffers = { };
 		std::vector<VmaAllocation> m_Allocations = { };
 
 		size_t m_Size = 0;
+
+		uint64_t m_ResourceID = VulkanDescriptorWriter::NextResourceID();
 	};
 
-	class VulkanDynamicUniformBuffer : public DynamicUniformBuffer
+	class VulkanDynamicUniformBuffer final : public DynamicUniformBuffer
 	{
 	public:
 		VulkanDynamicUniformBuffer(uint32_t elements, size_t sizeOfOneElement);
@@ -77,8 +84,8 @@ namespace Swift
 		inline uint32_t GetAmountOfElements() const override { return m_ElementCount; }
 		inline size_t GetAlignment() const override { return m_AlignmentOfOneElement; }
 
-		void Upload(Ref<DescriptorSet> set, Descriptor element) override;
-		void Upload(Ref<DescriptorSet> set, Descriptor element, size_t offset) override;
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element) override;
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element, size_t offset) override;
 
 	private:
 		std::vector<VkBuffer> m_Buffers = { };
@@ -89,9 +96,11 @@ namespace Swift
 		size_t m_AlignmentOfOneElement = 0;
 
 		std::vector<std::pair<void*, size_t>> m_IndexedData = { };
+
+		uint64_t m_ResourceID = VulkanDescriptorWriter::NextResourceID();
 	};
 
-	class VulkanStorageBuffer : public StorageBuffer
+	class VulkanStorageBuffer final : public StorageBuffer
 	{
 	public:
 		VulkanStorageBuffer(size_t dataSize);
@@ -104,13 +113,17 @@ namespace Swift
 
 		size_t GetSize() const override { return m_Size; }
 
-		void Upload(Ref<DescriptorSet> set, Descriptor element) override;
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element) override;
+
+		inline VkBuffer GetVulkanBuffer(uint32_t index) { return m_Buffers[index]; }
 
 	private:
 		std::vector<VkBuffer> m_Buffers = { };
 		std::vector<VmaAllocation> m_Allocations = { };
 
 		size_t m_Size = 0;
+
+		uint64_t m_ResourceID = VulkanDescriptorWriter::NextResourceID();
 	};
 
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "swpch.h"
 #include "VulkanCommandBuffer.hpp"
 
+#include <mutex>
+#include <unordered_set>
+
 #include "Swift/Core/Logging.hpp"
 #include "Swift/Utils/Profiler.hpp"
 
@@ -13,6 +16,17 @@
 namespace Swift
 {
 
+	// Note(Jorben): Timer names are interned once, so resolving timers every frame only copies pointers.
+	// Nodes of an unordered_set never move, so the pointers stay valid.
+	static const char* InternTimerName(const std::string& name)
+	{
+		static std::mutex s_Mutex = {};
+		static std::unordered_set<std::string> s_Names = { };
+
+		std::scoped_lock<std::mutex> lock(s_Mutex);
+		return s_Names.insert(name).first->c_str();
+	}
+
 	VulkanCommandBuffer::VulkanCommandBuffer(CommandBufferSpecification specs)
 		: m_Specification(specs)
 	{
@@ -55,6 +69,27 @@ namespace Swift
 				APP_LOG_ERROR("Failed to create synchronization objects for a frame!");
 			}
 		}
+
+		if (renderer->GetPhysicalDevice()->GetTimestampSupport().Supported)
+		{
+			m_QueryPools.resize(framesInFlight);
+			m_TimerNames.resize(framesInFlight);
+			m_TimersSubmitted.resize(framesInFlight, 0);
+
+			for (auto& names : m_TimerNames)
+				names.reserve(s_MaxTimers);
+
+			VkQueryPoolCreateInfo queryPoolInfo = {};
+			queryPoolInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+			queryPoolInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+			queryPoolInfo.queryCount = s_MaxTimers * 2;
+
+			for (size_t i = 0; i < framesInFlight; i++)
+			{
+				if (vkCreateQueryPool(device, &queryPoolInfo, nullptr, &m_QueryPools[i]) != VK_SUCCESS)
+					APP_LOG_ERROR("Failed to create timestamp query pool!");
+			}
+		}
 	}
 
 	VulkanCommandBuffer::~VulkanCommandBuffer()
@@ -62,8 +97,9 @@ namespace Swift
 		auto commandBuffers = m_CommandBuffers;
 		auto renderFinishedSemaphores = m_RenderFinishedSemaphores;
 		auto inFlightFences = m_InFlightFences;
+		auto queryPools = m_QueryPools;
 
-		Renderer::SubmitFree([commandBuffers, renderFinishedSemaphores, inFlightFences]()
+		Renderer::SubmitFree([commandBuffers, renderFinishedSemaphores, inFlightFences, queryPools]()
 		{
 			auto renderer = (VulkanRenderer*)Renderer::GetInstance();
 			auto device = renderer->GetLogicalDevice()->GetVulkanDevice();
@@ -78,6 +114,9 @@ namespace Swift
 				vkDestroySemaphore(device, renderFinishedSemaphores[i], nullptr);
 				vkDestroyFence(device, inFlightFences[i], nullptr);
 			}
+
+			for (auto& pool : queryPools)
+				vkDestroyQueryPool(device, pool, nullptr);
 		});
 	}
 
@@ -88,8 +127,12 @@ namespace Swift
 		uint32_t currentFrame = Renderer::GetCurrentFrame();
 		VkCommandBuffer commandBuffer = m_CommandBuffers[currentFrame];
 
+		// Note(Jorben): The frame's fence has already been waited on, so last time's timers are done (or were never submitted)
+		ResolveTimers(currentFrame);
+
 		vkResetFences(device, 1, &m_InFlightFences[currentFrame]);
 		vkResetCommandBuffer(commandBuffer, 0);
+		InvalidateState();
 
 		VkCommandBufferBeginInfo beginInfo = {};
 		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
@@ -98,12 +141,24 @@ namespace Swift
 			if (vkBeginCommandBuffer(commandBuffer, &beginInfo) != VK_SUCCESS)
 				APP_LOG_ERROR("Failed to begin recording command buffer!");
 		}
+
+		APP_PROFILE_GPU_COLLECT(renderer->GetProfilerContext(), commandBuffer);
+
+		if (!m_QueryPools.empty())
+		{
+			vkCmdResetQueryPool(commandBuffer, m_QueryPools[currentFrame], 0, s_MaxTimers * 2);
+			m_TimersSubmitted[currentFrame] = 0;
+		}
 	}
 
 	void VulkanCommandBuffer::End()
 	{
 		APP_PROFILE_SCOPE("VulkanCommandBuffer::End::End");
 
+		// Note(Jorben): Timers that are still open would never become available, which would discard all of this frame's timers
+		while (!m_OpenTimers.empty())
+			EndTimer();
+
 		if (vkEndCommandBuffer(m_CommandBuffers[Renderer::GetCurrentFrame()]) != VK_SUCCESS)
 			APP_LOG_ERROR("Failed to record command buffer!");
 	}
@@ -123,7 +178,7 @@ namespace Swift
 
 		for (auto& cmd : waitOn)
 		{
-			auto vkCmd = RefHelper::RefAs<VulkanCommandBuffer>(cmd);
+			auto vkCmd = RefHelper::RawAs<VulkanCommandBuffer>(cmd);
 			auto semaphore = vkCmd->GetRenderFinishedSemaphore(currentFrame);
 
 			semaphores.push_back(semaphore);
@@ -170,8 +225,13 @@ namespace Swift
 			
 			if (result != VK_SUCCESS)
 				APP_LOG_ERROR("Failed to submit draw command buffer! Error: {0}", VkResultToString(result));
+
+			Renderer::GetCurrentRenderData().Submits++;
 		}
 
+		if (!m_QueryPools.empty())
+			m_TimersSubmitted[currentFrame] = 1;
+
 		if (m_Specification.Usage & CommandBufferUsage::Sequence)
 			VulkanTaskManager::AddSemaphore(m_RenderFinishedSemaphores[currentFrame]);
 		if (m_Specification.Usage & CommandBufferUsage::Parallel)
@@ -192,4 +252,194 @@ namespace Swift
 		vkResetFences(renderer->GetLogicalDevice()->GetVulkanDevice(), 1, &m_InFlightFences[currentFrame]);
 	}
 
+	void VulkanCommandBuffer::BeginTimer(const std::string& name)
+	{
+		if (m_QueryPools.empty())
+			return;
+
+		uint32_t currentFrame = Renderer::GetCurrentFrame();
+		auto& names = m_TimerNames[currentFrame];
+
+		if (names.size() >= s_MaxTimers)
+		{
+			APP_LOG_WARN("Exceeded the maximum amount of timers ({0}) in one commandbuffer, '{1}' won't be measured.", s_MaxTimers, name);
+			m_OpenTimers.push_back(MAX_UINT32);
+			return;
+		}
+
+		uint32_t index = (uint32_t)names.size();
+		names.push_back(InternTimerName(name));
+		m_OpenTimers.push_back(index);
+
+		vkCmdWriteTimestamp(m_CommandBuffers[currentFrame], VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_QueryPools[currentFrame], index * 2);
+	}
+
+	void VulkanCommandBuffer::EndTimer()
+	{
+		if (m_QueryPools.empty() || m_OpenTimers.empty())
+			return;
+
+		uint32_t index = m_OpenTimers.back();
+		m_OpenTimers.pop_back();
+
+		if (index == MAX_UINT32)
+			return;
+
+		uint32_t currentFrame = Renderer::GetCurrentFrame();
+		vkCmdWriteTimestamp(m_CommandBuffers[currentFrame], VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_QueryPools[currentFrame], index * 2 + 1);
+	}
+
+	void VulkanCommandBuffer::ResolveTimers(uint32_t frame)
+	{
+		m_OpenTimers.clear();
+		if (m_QueryPools.empty() || m_TimerNames[frame].empty())
+			return;
+
+		auto& names = m_TimerNames[frame];
+
+		// Note(Jorben): If the recording was never submitted the reset of the pool never executed, reading it would be invalid
+		if (!m_TimersSubmitted[frame])
+		{
+			names.clear();
+			return;
+		}
+
+		auto renderer = (VulkanRenderer*)Renderer::GetInstance();
+		auto& support = renderer->GetPhysicalDevice()->GetTimestampSupport();
+
+		std::array<uint64_t, s_MaxTimers * 2> timestamps = { };
+		uint32_t queryCount = (uint32_t)names.size() * 2;
+
+		// Note(Jorben): No VK_QUERY_RESULT_WAIT_BIT, if the results aren't there we skip them instead of stalling
+		VkResult result = vkGetQueryPoolResults(renderer->GetLogicalDevice()->GetVulkanDevice(), m_QueryPools[frame], 0, queryCount, 
+			queryCount * sizeof(uint64_t), timestamps.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+
+		if (result == VK_SUCCESS)
+		{
+			auto& data = Renderer::GetCurrentRenderData();
+			for (size_t i = 0; i < names.size(); i++)
+			{
+				uint64_t ticks = ((timestamps[i * 2 + 1] & support.Mask) - (timestamps[i * 2] & support.Mask)) & support.Mask;
+				data.GPUTimings.push_back({ names[i], (float)((double)ticks * (double)support.Period / 1000000.0) });
+			}
+		}
+
+		names.clear();
+	}
+
+	void VulkanCommandBuffer::BindPipeline(VkPipelineBindPoint bindPoint, VkPipeline pipeline)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+
+		// Note(Jorben): Only graphics & compute get tracked, anything else is always bound
+		if (bindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS || bindPoint == VK_PIPELINE_BIND_POINT_COMPUTE)
+		{
+			VkPipeline& bound = m_State.Pipelines[(size_t)bindPoint];
+			if (bound == pipeline)
+			{
+				data.ElidedBinds++;
+				return;
+			}
+
+			bound = pipeline;
+		}
+
+		data.Binds++;
+		vkCmdBindPipeline(m_CommandBuffers[Renderer::GetCurrentFrame()], bindPoint, pipeline);
+	}
+
+	void VulkanCommandBuffer::BindDescriptorSet(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t setID, VkDescriptorSet set, const std::vector<uint32_t>& dynamicOffsets)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+
+		if (bindPoint == VK_PIPELINE_BIND_POINT_GRAPHICS || bindPoint == VK_PIPELINE_BIND_POINT_COMPUTE)
+		{
+			auto& sets = m_State.DescriptorSets[(size_t)bindPoint];
+			if ((size_t)setID >= sets.size())
+				sets.resize((size_t)setID + 1);
+
+			BoundDescriptorSet& bound = sets[setID];
+			if (bound.Layout == layout && bound.Set == set && bound.DynamicOffsets == dynamicOffsets)
+			{
+				data.ElidedBinds++;
+				return;
+			}
+
+			// Note(Jorben): Binding with a different layout can disturb the other sets, so we stop trusting those
+			for (auto& other : sets)
+			{
+				if (other.Layout != layout)
+					other = {};
+			}
+
+			bound = { layout, set, dynamicOffsets };
+		}
+
+		data.Binds++;
+		vkCmdBindDescriptorSets(m_CommandBuffers[Renderer::GetCurrentFrame()], bindPoint, layout, setID, 1, &set, (uint32_t)dynamicOffsets.size(), dynamicOffsets.data());
+	}
+
+	void VulkanCommandBuffer::BindVertexBuffer(VkBuffer buffer, VkDeviceSize offset)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+		if (m_State.VertexBuffer == buffer && m_State.VertexOffset == offset)
+		{
+			data.ElidedBinds++;
+			return;
+		}
+
+		m_State.VertexBuffer = buffer;
+		m_State.VertexOffset = offset;
+
+		data.Binds++;
+		vkCmdBindVertexBuffers(m_CommandBuffers[Renderer::GetCurrentFrame()], 0, 1, &buffer, &offset);
+	}
+
+	void VulkanCommandBuffer::BindIndexBuffer(VkBuffer buffer, VkIndexType type, VkDeviceSize offset)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+		if (m_State.IndexBuffer == buffer && m_State.IndexType == type && m_State.IndexOffset == offset)
+		{
+			data.ElidedBinds++;
+			return;
+		}
+
+		m_State.IndexBuffer = buffer;
+		m_State.IndexType = type;
+		m_State.IndexOffset = offset;
+
+		data.Binds++;
+		vkCmdBindIndexBuffer(m_CommandBuffers[Renderer::GetCurrentFrame()], buffer, offset, type);
+	}
+
+	void VulkanCommandBuffer::SetViewport(const VkViewport& viewport)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+		if (m_State.Viewport && memcmp(&m_State.Viewport.value(), &viewport, sizeof(VkViewport)) == 0)
+		{
+			data.ElidedBinds++;
+			return;
+		}
+
+		m_State.Viewport = viewport;
+
+		data.Binds++;
+		vkCmdSetViewport(m_CommandBuffers[Renderer::GetCurrentFrame()], 0, 1, &viewport);
+	}
+
+	void VulkanCommandBuffer::SetScissor(const VkRect2D& scissor)
+	{
+		auto& data = Renderer::GetCurrentRenderData();
+		if (m_State.Scissor && memcmp(&m_State.Scissor.value(), &scissor, sizeof(VkRect2D)) == 0)
+		{
+			data.ElidedBinds++;
+			return;
+		}
+
+		m_State.Scissor = scissor;
+
+		data.Binds++;
+		vkCmdSetScissor(m_CommandBuffers[Renderer::GetCurrentFrame()], 0, 1, &scissor);
+	}
+
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
+#include <string>
 #include <vector>
+#include <optional>
 
 #include "Swift/Core/Core.hpp"
 #include "Swift/Utils/Utils.hpp"
@@ -12,7 +15,7 @@
 namespace Swift
 {
 
-	class VulkanCommandBuffer : public CommandBuffer
+	class VulkanCommandBuffer final : public CommandBuffer
 	{
 	public:
 		VulkanCommandBuffer(CommandBufferSpecification specs);
@@ -24,18 +27,70 @@ namespace Swift
 
 		void WaitOnFinish() override;
 
+		void BeginTimer(const std::string& name) override;
+		void EndTimer() override;
+
 		inline VkSemaphore GetRenderFinishedSemaphore(uint32_t index) { return m_RenderFinishedSemaphores[index]; }
 		inline VkFence GetInFlightFence(uint32_t index) { return m_InFlightFences[index]; }
 		inline VkCommandBuffer GetVulkanCommandBuffer(uint32_t index) { return m_CommandBuffers[index]; }
 
+		// Note(Jorben): These record into the current frame's commandbuffer, but only when the state differs from what is already bound.
+		void BindPipeline(VkPipelineBindPoint bindPoint, VkPipeline pipeline);
+		void BindDescriptorSet(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t setID, VkDescriptorSet set, const std::vector<uint32_t>& dynamicOffsets = { });
+		void BindVertexBuffer(VkBuffer buffer, VkDeviceSize offset = 0);
+		void BindIndexBuffer(VkBuffer buffer, VkIndexType type, VkDeviceSize offset = 0);
+		void SetViewport(const VkViewport& viewport);
+		void SetScissor(const VkRect2D& scissor);
+
+		// Note(Jorben): Needs to be called after recording commands directly into the VkCommandBuffer.
+		inline void InvalidateState() { m_State = {}; }
+
+	private:
+		void ResolveTimers(uint32_t frame);
+
+	private:
+		struct BoundDescriptorSet
+		{
+		public:
+			VkPipelineLayout Layout = VK_NULL_HANDLE;
+			VkDescriptorSet Set = VK_NULL_HANDLE;
+			std::vector<uint32_t> DynamicOffsets = { };
+		};
+
+		struct BoundState
+		{
+		public:
+			std::array<VkPipeline, 2> Pipelines = { }; // Note(Jorben): Graphics & Compute
+			std::array<std::vector<BoundDescriptorSet>, 2> DescriptorSets = { };
+
+			VkBuffer VertexBuffer = VK_NULL_HANDLE;
+			VkDeviceSize VertexOffset = 0;
+			VkBuffer IndexBuffer = VK_NULL_HANDLE;
+			VkDeviceSize IndexOffset = 0;
+			VkIndexType IndexType = VK_INDEX_TYPE_MAX_ENUM;
+
+			std::optional<VkViewport> Viewport = {};
+			std::optional<VkRect2D> Scissor = {};
+		};
+
 	private:
 		CommandBufferSpecification m_Specification = {};
 
+		// Note(Jorben): Only valid while recording, gets reset on Begin()
+		BoundState m_State = {};
+
 		std::vector<VkCommandBuffer> m_CommandBuffers = { };
 
 		// Sync objects
 		std::vector<VkSemaphore> m_RenderFinishedSemaphores = { };
 		std::vector<VkFence> m_InFlightFences = { };
+
+		// Timers
+		inline static constexpr const uint32_t s_MaxTimers = 32; // Note(Jorben): Every timer uses 2 queries, a begin & an end timestamp
+		std::vector<VkQueryPool> m_QueryPools = { }; // Note(Jorben): One for every frame in flight, so reading back never waits on the GPU
+		std::vector<std::vector<const char*>> m_TimerNames = { }; // Note(Jorben): The timers that were recorded into every frame's pool (interned names)
+		std::vector<uint8_t> m_TimersSubmitted = { }; // Note(Jorben): Whether the frame's recording (which resets the pool) was actually submitted
+		std::vector<uint32_t> m_OpenTimers = { };
 	};
 
 }
\ No newline at end of file
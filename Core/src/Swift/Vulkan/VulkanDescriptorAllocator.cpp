@@ -0,0 +1,231 @@
+#include "swpch.h"
+#include "VulkanDescriptorAllocator.hpp"
+
+#include "Swift/Core/Logging.hpp"
+#include "Swift/Utils/Profiler.hpp"
+
+#include "Swift/Renderer/Renderer.hpp"
+
+#include "Swift/Vulkan/VulkanUtils.hpp"
+#include "Swift/Vulkan/VulkanRenderer.hpp"
+#include "Swift/Vulkan/VulkanDescriptors.hpp"
+#include "Swift/Vulkan/VulkanDescriptorWriter.hpp"
+
+namespace Swift
+{
+
+	VulkanDescriptorAllocator::VulkanDescriptorAllocator(VkDescriptorSetLayout layout, const DescriptorSetLayout& description)
+		: m_Layout(layout), m_Description(description)
+	{
+		CreateUpdateTemplate();
+	}
+
+	VulkanDescriptorAllocator::~VulkanDescriptorAllocator()
+	{
+		std::vector<VkDescriptorPool> pools = m_Pools;
+		for (auto& transient : m_TransientPools)
+			pools.insert(pools.end(), transient.Pools.begin(), transient.Pools.end());
+
+		auto updateTemplate = m_UpdateTemplate;
+		auto layout = m_Layout;
+
+		Renderer::SubmitFree([pools, updateTemplate, layout]()
+		{
+			auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+
+			for (auto& pool : pools)
+				vkDestroyDescriptorPool(device, pool, nullptr);
+
+			if (updateTemplate != VK_NULL_HANDLE)
+				vkDestroyDescriptorUpdateTemplate(device, updateTemplate, nullptr);
+
+			if (layout != VK_NULL_HANDLE)
+				vkDestroyDescriptorSetLayout(device, layout, nullptr);
+		});
+	}
+
+	VkDescriptorSet VulkanDescriptorAllocator::Allocate()
+	{
+		APP_PROFILE_SCOPE("VulkanDescriptorAllocator::Allocate");
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		// Move all sets the GPU can't be using anymore to the free list
+		constexpr const uint64_t framesInFlight = (uint64_t)RendererSpecification::BufferCount;
+		uint64_t frame = GetFrameCount();
+
+		for (auto it = m_PendingSets.begin(); it != m_PendingSets.end();)
+		{
+			if (it->Frame + framesInFlight <= frame)
+			{
+				m_FreeSets.push_back(it->Set);
+				it = m_PendingSets.erase(it);
+			}
+			else
+			{
+				it++;
+			}
+		}
+
+		if (!m_FreeSets.empty())
+		{
+			VkDescriptorSet set = m_FreeSets.back();
+			m_FreeSets.pop_back();
+			return set;
+		}
+
+		VkDescriptorSet set = m_Pools.empty() ? VK_NULL_HANDLE : AllocateFromPool(m_Pools.back());
+		if (set == VK_NULL_HANDLE)
+		{
+			// Note(Jorben): Every new pool in the chain is twice as big as the previous one (up to s_MaxPoolSize)
+			m_Pools.push_back(CreatePool(m_NextPoolSize));
+			m_NextPoolSize = std::min(m_NextPoolSize * 2, s_MaxPoolSize);
+
+			set = AllocateFromPool(m_Pools.back());
+		}
+
+		return set;
+	}
+
+	void VulkanDescriptorAllocator::Free(VkDescriptorSet set)
+	{
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+		m_PendingSets.push_back({ set, GetFrameCount() });
+	}
+
+	VkDescriptorSet VulkanDescriptorAllocator::AllocateTransient()
+	{
+		APP_PROFILE_SCOPE("VulkanDescriptorAllocator::AllocateTransient");
+		std::scoped_lock<std::mutex> lock(m_Mutex);
+
+		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+
+		TransientPools& transient = m_TransientPools[Renderer::GetCurrentFrame()];
+
+		// Note(Jorben): The first allocation in a new frame resets all pools of this frame index,
+		// the last time they were used is at least one full round of frames in flight ago.
+		uint64_t frame = GetFrameCount();
+		if (transient.Frame != frame)
+		{
+			for (auto& pool : transient.Pools)
+				vkResetDescriptorPool(device, pool, 0);
+
+			transient.Current = 0;
+			transient.Frame = frame;
+		}
+
+		while (true)
+		{
+			if (transient.Current == transient.Pools.size())
+				transient.Pools.push_back(CreatePool(s_MaxPoolSize));
+
+			VkDescriptorSet set = AllocateFromPool(transient.Pools[transient.Current]);
+			if (set != VK_NULL_HANDLE)
+				return set;
+
+			transient.Current++;
+		}
+	}
+
+	Ref<VulkanDescriptorAllocator> VulkanDescriptorAllocator::Create(VkDescriptorSetLayout layout, const DescriptorSetLayout& description)
+	{
+		return RefHelper::Create<VulkanDescriptorAllocator>(layout, description);
+	}
+
+	VkDescriptorPool VulkanDescriptorAllocator::CreatePool(uint32_t maxSets)
+	{
+		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+
+		std::vector<VkDescriptorPoolSize> poolSizes = { };
+		for (auto& type : m_Description.UniqueTypes())
+		{
+			VkDescriptorPoolSize poolSize = {};
+			poolSize.type = DescriptorTypeToVulkanDescriptorType(type);
+			poolSize.descriptorCount = m_Description.AmountOf(type) * maxSets;
+
+			poolSizes.push_back(poolSize);
+		}
+
+		VkDescriptorPoolCreateInfo poolInfo = {};
+		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		poolInfo.poolSizeCount = (uint32_t)poolSizes.size();
+		poolInfo.pPoolSizes = poolSizes.data();
+		poolInfo.maxSets = maxSets;
+
+		VkDescriptorPool pool = VK_NULL_HANDLE;
+		if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &pool) != VK_SUCCESS)
+			APP_LOG_ERROR("Failed to create descriptor pool!");
+
+		return pool;
+	}
+
+	void VulkanDescriptorAllocator::CreateUpdateTemplate()
+	{
+		if (m_Description.Descriptors.empty())
+			return;
+
+		std::vector<Descriptor> descriptors = { };
+		descriptors.reserve(m_Description.Descriptors.size());
+
+		for (auto& pair : m_Description.Descriptors)
+			descriptors.push_back(pair.second);
+		std::sort(descriptors.begin(), descriptors.end(), [](const Descriptor& a, const Descriptor& b) { return a.Binding < b.Binding; });
+
+		std::vector<VkDescriptorUpdateTemplateEntry> entries(descriptors.size());
+		m_TemplateBindings.resize(descriptors.size());
+
+		for (size_t i = 0; i < descriptors.size(); i++)
+		{
+			entries[i].dstBinding = descriptors[i].Binding;
+			entries[i].dstArrayElement = 0;
+			entries[i].descriptorCount = 1;
+			entries[i].descriptorType = DescriptorTypeToVulkanDescriptorType(descriptors[i].Type);
+			entries[i].offset = i * sizeof(VulkanDescriptorInfo);
+			entries[i].stride = sizeof(VulkanDescriptorInfo);
+
+			m_TemplateBindings[i] = descriptors[i].Binding;
+		}
+
+		VkDescriptorUpdateTemplateCreateInfo templateInfo = {};
+		templateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+		templateInfo.descriptorUpdateEntryCount = (uint32_t)entries.size();
+		templateInfo.pDescriptorUpdateEntries = entries.data();
+		templateInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+		templateInfo.descriptorSetLayout = m_Layout;
+
+		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+		if (vkCreateDescriptorUpdateTemplate(device, &templateInfo, nullptr, &m_UpdateTemplate) != VK_SUCCESS)
+		{
+			APP_LOG_ERROR("Failed to create descriptor update template!");
+			m_UpdateTemplate = VK_NULL_HANDLE;
+			m_TemplateBindings.clear();
+		}
+	}
+
+	VkDescriptorSet VulkanDescriptorAllocator::AllocateFromPool(VkDescriptorPool pool)
+	{
+		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+
+		VkDescriptorSetAllocateInfo allocInfo = {};
+		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocInfo.descriptorPool = pool;
+		allocInfo.descriptorSetCount = 1;
+		allocInfo.pSetLayouts = &m_Layout;
+
+		VkDescriptorSet set = VK_NULL_HANDLE;
+		VkResult res = vkAllocateDescriptorSets(device, &allocInfo, &set);
+
+		// Note(Jorben): Running out of pool memory is expected, the caller moves on to a new pool
+		if (res == VK_ERROR_OUT_OF_POOL_MEMORY || res == VK_ERROR_FRAGMENTED_POOL)
+			return VK_NULL_HANDLE;
+		else if (res != VK_SUCCESS)
+			APP_LOG_ERROR("Failed to allocate descriptor set! Error: {0}", VkResultToString(res));
+
+		return set;
+	}
+
+	uint64_t VulkanDescriptorAllocator::GetFrameCount() const
+	{
+		return ((VulkanRenderer*)Renderer::GetInstance())->GetSwapChain()->GetFrameCount();
+	}
+
+}
\ No newline at end of file
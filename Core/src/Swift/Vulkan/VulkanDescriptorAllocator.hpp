@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+#include "Swift/Core/Core.hpp"
+#include "Swift/Utils/Utils.hpp"
+
+#include "Swift/Renderer/RendererConfig.hpp"
+#include "Swift/Renderer/Descriptors.hpp"
+
+#include <vulkan/vulkan.h>
+
+namespace Swift
+{
+
+	// Note(Jorben): Allocates descriptor sets of a single layout.
+	// Long lived sets come from a chain of (growing) pools and get recycled through a free list once the GPU is done with them.
+	// Transient sets come from per frame pools which are reset as a whole when that frame comes around again.
+	// The allocator takes ownership of the layout, since its sets (and their writers) can outlive the VulkanDescriptorSets that created it.
+	class VulkanDescriptorAllocator
+	{
+	public:
+		VulkanDescriptorAllocator(VkDescriptorSetLayout layout, const DescriptorSetLayout& description);
+		virtual ~VulkanDescriptorAllocator();
+
+		VkDescriptorSet Allocate();
+		// Note(Jorben): The set is only reused after all frames in flight that could be using it are finished.
+		void Free(VkDescriptorSet set);
+
+		// Note(Jorben): Only valid for the current frame.
+		VkDescriptorSet AllocateTransient();
+
+		// Note(Jorben): Writes every binding (in the order of GetTemplateBindings()) from an array of VulkanDescriptorInfo.
+		inline VkDescriptorUpdateTemplate GetUpdateTemplate() const { return m_UpdateTemplate; }
+		inline const std::vector<uint32_t>& GetTemplateBindings() const { return m_TemplateBindings; }
+
+		static Ref<VulkanDescriptorAllocator> Create(VkDescriptorSetLayout layout, const DescriptorSetLayout& description);
+
+	private:
+		void CreateUpdateTemplate();
+		VkDescriptorPool CreatePool(uint32_t maxSets);
+		VkDescriptorSet AllocateFromPool(VkDescriptorPool pool);
+
+		uint64_t GetFrameCount() const;
+
+	private:
+		inline static constexpr const uint32_t s_InitialPoolSize = 8;
+		inline static constexpr const uint32_t s_MaxPoolSize = 512;
+
+		struct PendingSet
+		{
+		public:
+			VkDescriptorSet Set = VK_NULL_HANDLE;
+			uint64_t Frame = 0; // Note(Jorben): The frame count at which the set was freed
+		};
+
+		struct TransientPools
+		{
+		public:
+			std::vector<VkDescriptorPool> Pools = { };
+			size_t Current = 0;
+			uint64_t Frame = 0; // Note(Jorben): The frame count at which these pools were last used
+		};
+
+	private:
+		std::mutex m_Mutex = {};
+
+		VkDescriptorSetLayout m_Layout = VK_NULL_HANDLE;
+		DescriptorSetLayout m_Description = {};
+
+		VkDescriptorUpdateTemplate m_UpdateTemplate = VK_NULL_HANDLE;
+		std::vector<uint32_t> m_TemplateBindings = { };
+
+		std::vector<VkDescriptorPool> m_Pools = { };
+		uint32_t m_NextPoolSize = s_InitialPoolSize;
+
+		std::vector<VkDescriptorSet> m_FreeSets = { };
+		std::vector<PendingSet> m_PendingSets = { };
+
+		std::array<TransientPools, (size_t)RendererSpecification::BufferCount> m_TransientPools = { };
+	};
+
+}
\ No newline at end of file
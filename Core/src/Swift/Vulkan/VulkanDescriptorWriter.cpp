@@ -0,0 +1,132 @@
+#include "swpch.h"
+#include "VulkanDescriptorWriter.hpp"
+
+#include "Swift/Core/Logging.hpp"
+#include "Swift/Utils/Profiler.hpp"
+
+#include "Swift/Renderer/Renderer.hpp"
+
+#include "Swift/Vulkan/VulkanRenderer.hpp"
+#include "Swift/Vulkan/VulkanDescriptorAllocator.hpp"
+
+namespace Swift
+{
+
+	VulkanDescriptorWriter::VulkanDescriptorWriter(Ref<VulkanDescriptorAllocator> allocator)
+		: m_Allocator(allocator)
+	{
+	}
+
+	void VulkanDescriptorWriter::WriteBuffer(uint32_t binding, VkDescriptorType type, const VkDescriptorBufferInfo& info, uint64_t resourceID)
+	{
+		Write write = {};
+		write.Binding = binding;
+		write.Type = type;
+		write.Info.Buffer = info;
+
+		write.Hash = Utils::ToolKit::Hash(&type, sizeof(VkDescriptorType));
+		write.Hash = Utils::ToolKit::Hash(&resourceID, sizeof(uint64_t), write.Hash);
+		write.Hash = Utils::ToolKit::Hash(&info.buffer, sizeof(VkBuffer), write.Hash);
+		write.Hash = Utils::ToolKit::Hash(&info.offset, sizeof(VkDeviceSize), write.Hash);
+		write.Hash = Utils::ToolKit::Hash(&info.range, sizeof(VkDeviceSize), write.Hash);
+
+		Queue(write);
+	}
+
+	void VulkanDescriptorWriter::WriteImage(uint32_t binding, VkDescriptorType type, const VkDescriptorImageInfo& info, uint64_t resourceID)
+	{
+		Write write = {};
+		write.Binding = binding;
+		write.Type = type;
+		write.Info.Image = info;
+
+		write.Hash = Utils::ToolKit::Hash(&type, sizeof(VkDescriptorType));
+		write.Hash = Utils::ToolKit::Hash(&resourceID, sizeof(uint64_t), write.Hash);
+		write.Hash = Utils::ToolKit::Hash(&info.sampler, sizeof(VkSampler), write.Hash);
+		write.Hash = Utils::ToolKit::Hash(&info.imageView, sizeof(VkImageView), write.Hash);
+		write.Hash = Utils::ToolKit::Hash(&info.imageLayout, sizeof(VkImageLayout), write.Hash);
+
+		Queue(write);
+	}
+
+	void VulkanDescriptorWriter::Flush(VkDescriptorSet set)
+	{
+		if (m_Writes.empty())
+			return;
+
+		APP_PROFILE_SCOPE("VulkanDescriptorWriter::Flush");
+
+		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+
+		// Note(Jorben): When the whole layout gets written we can let the driver use the precompiled template
+		VkDescriptorUpdateTemplate updateTemplate = (m_Allocator ? m_Allocator->GetUpdateTemplate() : VK_NULL_HANDLE);
+		if (updateTemplate != VK_NULL_HANDLE && m_Writes.size() == m_Allocator->GetTemplateBindings().size())
+		{
+			const std::vector<uint32_t>& bindings = m_Allocator->GetTemplateBindings();
+			std::vector<VulkanDescriptorInfo> data(bindings.size());
+
+			bool complete = true;
+			for (size_t i = 0; i < bindings.size() && complete; i++)
+			{
+				auto it = std::find_if(m_Writes.begin(), m_Writes.end(), [binding = bindings[i]](const Write& write) { return write.Binding == binding; });
+				if (it == m_Writes.end())
+					complete = false;
+				else
+					data[i] = it->Info;
+			}
+
+			if (complete)
+			{
+				vkUpdateDescriptorSetWithTemplate(device, set, updateTemplate, data.data());
+
+				for (auto& write : m_Writes)
+					m_Contents[write.Binding] = write.Hash;
+				m_Writes.clear();
+				return;
+			}
+		}
+
+		std::vector<VkWriteDescriptorSet> descriptorWrites(m_Writes.size());
+		for (size_t i = 0; i < m_Writes.size(); i++)
+		{
+			const Write& write = m_Writes[i];
+
+			descriptorWrites[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrites[i].dstSet = set;
+			descriptorWrites[i].dstBinding = write.Binding;
+			descriptorWrites[i].dstArrayElement = 0;
+			descriptorWrites[i].descriptorType = write.Type;
+			descriptorWrites[i].descriptorCount = 1;
+
+			if (write.Type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER || write.Type == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE || write.Type == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE || write.Type == VK_DESCRIPTOR_TYPE_SAMPLER)
+				descriptorWrites[i].pImageInfo = &write.Info.Image;
+			else
+				descriptorWrites[i].pBufferInfo = &write.Info.Buffer;
+
+			m_Contents[write.Binding] = write.Hash;
+		}
+
+		vkUpdateDescriptorSets(device, (uint32_t)descriptorWrites.size(), descriptorWrites.data(), 0, nullptr);
+		Renderer::GetCurrentRenderData().DescriptorWrites += (uint32_t)descriptorWrites.size();
+		m_Writes.clear();
+	}
+
+	void VulkanDescriptorWriter::Queue(const Write& write)
+	{
+		auto pending = std::find_if(m_Writes.begin(), m_Writes.end(), [&write](const Write& other) { return other.Binding == write.Binding; });
+
+		// Note(Jorben): A later write to the same binding replaces the earlier one
+		if (pending != m_Writes.end())
+		{
+			*pending = write;
+			return;
+		}
+
+		auto current = m_Contents.find(write.Binding);
+		if (current != m_Contents.end() && current->second == write.Hash)
+			return;
+
+		m_Writes.push_back(write);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include "Swift/Core/Core.hpp"
+#include "Swift/Utils/Utils.hpp"
+
+#include <vulkan/vulkan.h>
+
+namespace Swift
+{
+
+	class VulkanDescriptorAllocator;
+
+	// Note(Jorben): Also used as the element of update template data, so every binding takes up the same amount of bytes.
+	union VulkanDescriptorInfo
+	{
+	public:
+		VkDescriptorBufferInfo Buffer;
+		VkDescriptorImageInfo Image;
+	};
+
+	// Note(Jorben): Accumulates the writes to a single VkDescriptorSet and submits them all at once on Flush().
+	// Writes that match what the set already holds are skipped and when every binding gets written the layout's update template is used.
+	// Note(Jorben): Handle values can be reused by the driver after a resource is destroyed, so every write also carries the
+	// resource's ID (see NextResourceID()), otherwise a new resource with a recycled handle would be skipped.
+	class VulkanDescriptorWriter
+	{
+	public:
+		VulkanDescriptorWriter(Ref<VulkanDescriptorAllocator> allocator = nullptr);
+		virtual ~VulkanDescriptorWriter() = default;
+
+		void WriteBuffer(uint32_t binding, VkDescriptorType type, const VkDescriptorBufferInfo& info, uint64_t resourceID);
+		void WriteImage(uint32_t binding, VkDescriptorType type, const VkDescriptorImageInfo& info, uint64_t resourceID);
+
+		void Flush(VkDescriptorSet set);
+
+		inline bool Empty() const { return m_Writes.empty(); }
+
+		// Note(Jorben): A unique ID for every resource (or recreation of its handles) that gets written into sets.
+		inline static uint64_t NextResourceID() { return s_NextResourceID.fetch_add(1, std::memory_order_relaxed); }
+
+	private:
+		struct Write
+		{
+		public:
+			uint32_t Binding = 0;
+			VkDescriptorType Type = VK_DESCRIPTOR_TYPE_MAX_ENUM;
+			VulkanDescriptorInfo Info = {};
+			uint64_t Hash = 0;
+		};
+
+	private:
+		void Queue(const Write& write);
+
+	private:
+		Ref<VulkanDescriptorAllocator> m_Allocator = nullptr;
+
+		std::vector<Write> m_Writes = { };
+		Dict<uint32_t, uint64_t> m_Contents = { }; // Note(Jorben): Binding -> hash of what the set currently holds
+
+		inline static std::atomic<uint64_t> s_NextResourceID = 1;
+	};
+
+}
\ No newline at end of file
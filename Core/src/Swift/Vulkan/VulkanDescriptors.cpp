@@ -8,32 +8,54 @@
 
 #include "Swift/Vulkan/VulkanUtils.hpp"
 #include "Swift/Vulkan/VulkanRenderer.hpp"
+#include "Swift/Vulkan/VulkanImage.hpp"
+#include "Swift/Vulkan/VulkanBuffers.hpp"
 #include "Swift/Vulkan/VulkanPipeline.hpp"
 #include "Swift/Vulkan/VulkanCommandBuffer.hpp"
+#include "Swift/Vulkan/VulkanDescriptorAllocator.hpp"
 
 namespace Swift
 {
 
 	static VkShaderStageFlags UniformStageFlagsToVulkanStageFlags(ShaderStage flags);
 
-	VulkanDescriptorSet::VulkanDescriptorSet(Descriptor::SetID setID, const std::vector<VkDescriptorSet>& sets)
-		: m_SetID(setID), m_Sets(sets)
+	VulkanDescriptorSet::VulkanDescriptorSet(Descriptor::SetID setID, const std::vector<VkDescriptorSet>& sets, Ref<VulkanDescriptorAllocator> allocator, bool transient)
+		: m_SetID(setID), m_Sets(sets), m_Allocator(allocator), m_Transient(transient)
 	{
+		m_Writers.resize((m_Transient ? 1 : m_Sets.size()), VulkanDescriptorWriter(m_Allocator));
 	}
 
-	void VulkanDescriptorSet::Bind(Ref<Pipeline> pipeline, Ref<CommandBuffer> commandBuffer, PipelineBindPoint bindPoint, const std::vector<uint32_t>& dynamicOffsets)
+	VulkanDescriptorSet::~VulkanDescriptorSet()
+	{
+		if (!m_Allocator || m_Transient)
+			return;
+
+		for (auto& set : m_Sets)
+			m_Allocator->Free(set);
+	}
+
+	void VulkanDescriptorSet::Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint, const std::vector<uint32_t>& dynamicOffsets)
 	{
 		APP_PROFILE_SCOPE("VulkanDescriptorSet::Bind");
 
-		auto vkPipelineLayout = RefHelper::RefAs<VulkanPipeline>(pipeline)->GetVulkanLayout();
-		auto vkCmdBuf = RefHelper::RefAs<VulkanCommandBuffer>(commandBuffer)->GetVulkanCommandBuffer(Renderer::GetCurrentFrame());
+		uint32_t frame = Renderer::GetCurrentFrame();
+		GetWriter(frame).Flush(m_Sets[frame]);
+
+		auto vkPipelineLayout = RefHelper::RawAs<VulkanPipeline>(pipeline)->GetVulkanLayout();
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
 
-		vkCmdBindDescriptorSets(vkCmdBuf, PipelineBindPointToVulkanBindPoint(bindPoint), vkPipelineLayout, m_SetID, 1, &m_Sets[Renderer::GetCurrentFrame()], (uint32_t)dynamicOffsets.size(), dynamicOffsets.data());
+		cmdBuf->BindDescriptorSet(PipelineBindPointToVulkanBindPoint(bindPoint), vkPipelineLayout, m_SetID, m_Sets[frame], dynamicOffsets);
 	}
 
-	Ref<DescriptorSet> VulkanDescriptorSet::Create(Descriptor::SetID setID, const std::vector<VkDescriptorSet>& sets)
+	void VulkanDescriptorSet::Flush()
 	{
-		return RefHelper::Create<VulkanDescriptorSet>(setID, sets);
+		for (size_t i = 0; i < m_Writers.size(); i++)
+			m_Writers[i].Flush(m_Sets[i]);
+	}
+
+	Ref<DescriptorSet> VulkanDescriptorSet::Create(Descriptor::SetID setID, const std::vector<VkDescriptorSet>& sets, Ref<VulkanDescriptorAllocator> allocator, bool transient)
+	{
+		return RefHelper::Create<VulkanDescriptorSet>(setID, sets, allocator, transient);
 	}
 
 	VulkanDescriptorSets::VulkanDescriptorSets(const std::initializer_list<AmountGroup>& sets)
@@ -43,40 +65,25 @@ namespace Swift
 			m_OriginalLayouts[layout.Layout.Set] = layout.Layout;
 
 			CreateDescriptorSetLayout(layout.Layout.Set);
-			CreateDescriptorPool(layout.Layout.Set, layout.Amount);
+			m_Allocators[layout.Layout.Set] = VulkanDescriptorAllocator::Create(m_DescriptorLayouts[layout.Layout.Set], layout.Layout);
 			CreateDescriptorSets(layout.Layout.Set, layout.Amount);
 		}
 	}
 
 	VulkanDescriptorSets::~VulkanDescriptorSets()
 	{
-		auto pools = m_DescriptorPools;
-		auto layouts = m_DescriptorLayouts;
-
-		Renderer::SubmitFree([pools, layouts]()
-		{
-			auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
-
-			for (auto& pool : pools)
-				vkDestroyDescriptorPool(device, pool.second, nullptr);
-
-			for (auto& layout : layouts)
-				vkDestroyDescriptorSetLayout(device, layout.second, nullptr);
-		});
+		// Note(Jorben): The layouts are owned (and destroyed) by the allocators, which live as long as any set allocated from them.
 	}
 
 	void VulkanDescriptorSets::SetAmount(Descriptor::SetID setID, uint32_t amount)
 	{
-		auto pool = m_DescriptorPools[setID];
-		Renderer::SubmitFree([pool]()
-		{
-			auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
-
-			vkDestroyDescriptorPool(device, pool, nullptr);
-		});
+		auto& sets = m_DescriptorSets[setID];
 
-		CreateDescriptorPool(setID, amount);
-		CreateDescriptorSets(setID, amount);
+		// Note(Jorben): Released sets go back to the allocator once nobody holds a reference anymore
+		if (amount < (uint32_t)sets.size())
+			sets.resize((size_t)amount);
+		else if (amount > (uint32_t)sets.size())
+			CreateDescriptorSets(setID, amount - (uint32_t)sets.size());
 	}
 
 	uint32_t VulkanDescriptorSets::GetAmount(Descriptor::SetID setID) const
@@ -113,6 +120,22 @@ namespace Swift
 		return it->second;
 	}
 
+	Ref<DescriptorSet> VulkanDescriptorSets::AllocateTransient(Descriptor::SetID setID)
+	{
+		auto it = m_Allocators.find(setID);
+		if (it == m_Allocators.end())
+		{
+			APP_LOG_ERROR("Failed to find descriptor set by ID: {0}", setID);
+			return nullptr;
+		}
+
+		// Note(Jorben): Every frame index points to the same set, since it's only used this frame
+		constexpr const size_t framesInFlight = (size_t)RendererSpecification::BufferCount;
+		std::vector<VkDescriptorSet> sets(framesInFlight, it->second->AllocateTransient());
+
+		return VulkanDescriptorSet::Create(setID, sets, it->second, true);
+	}
+
 	void VulkanDescriptorSets::CreateDescriptorSetLayout(Descriptor::SetID setID)
 	{
 		std::vector<VkDescriptorSetLayoutBinding> layouts = { };
@@ -139,79 +162,309 @@ namespace Swift
 			APP_LOG_ERROR("Failed to create descriptor set layout!");
 	}
 
-	void VulkanDescriptorSets::CreateDescriptorPool(Descriptor::SetID setID, uint32_t amount)
+	void VulkanDescriptorSets::CreateDescriptorSets(Descriptor::SetID setID, uint32_t amount)
 	{
-		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+		constexpr const uint32_t framesInFlight = (uint32_t)RendererSpecification::BufferCount;
 
-		// Note(Jorben): Just for myself, the poolSizes is just the amount of elements of a certain type to able to allocate per pool
-		std::vector<VkDescriptorPoolSize> poolSizes = { };
-		poolSizes.resize(m_OriginalLayouts[setID].UniqueTypes().size());
-		poolSizes.clear(); // Note(Jorben): For some reason without this line there is a VK_SAMPLER or something in the list.
+		auto& allocator = m_Allocators[setID];
+		auto& sets = m_DescriptorSets[setID];
+		sets.reserve(sets.size() + (size_t)amount);
 
-		constexpr const uint32_t framesInFlight = (uint32_t)RendererSpecification::BufferCount;
-		for (auto& type : m_OriginalLayouts[setID].UniqueTypes())
+		for (uint32_t i = 0; i < amount; i++)
 		{
-			VkDescriptorPoolSize poolSize = {};
-			poolSize.type = DescriptorTypeToVulkanDescriptorType(type);
-			poolSize.descriptorCount = m_OriginalLayouts[setID].AmountOf(type) * framesInFlight * amount;
+			std::vector<VkDescriptorSet> setCombo = { };
 
-			poolSizes.push_back(poolSize);
+			for (uint32_t j = 0; j < framesInFlight; j++)
+				setCombo.push_back(allocator->Allocate());
+
+			sets.push_back(VulkanDescriptorSet::Create(setID, setCombo, allocator));
 		}
+	}
 
-		VkDescriptorPoolCreateInfo poolInfo = {};
-		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-		poolInfo.poolSizeCount = (uint32_t)poolSizes.size();
-		poolInfo.pPoolSizes = poolSizes.data();
-		poolInfo.maxSets = framesInFlight * amount; // A set for every frame in flight
 
-		m_DescriptorPools[setID] = VK_NULL_HANDLE;
-		if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_DescriptorPools[setID]) != VK_SUCCESS)
-			APP_LOG_ERROR("Failed to create descriptor pool!");
+	VulkanBindlessDescriptors::VulkanBindlessDescriptors(const BindlessSpecification& specs)
+		: m_Specification(specs)
+	{
+		if (!((VulkanRenderer*)Renderer::GetInstance())->GetPhysicalDevice()->GetBindlessSupport().Supported)
+		{
+			APP_LOG_ERROR("Bindless descriptors are not supported by this device.");
+			return;
+		}
+
+		m_Images.Resources.resize((size_t)m_Specification.MaxImages);
+		m_StorageBuffers.Resources.resize((size_t)m_Specification.MaxStorageBuffers);
+
+		CreateDescriptorSetLayout();
+		CreateDescriptorSets();
 	}
 
-	void VulkanDescriptorSets::CreateDescriptorSets(Descriptor::SetID setID, uint32_t amount)
+	VulkanBindlessDescriptors::~VulkanBindlessDescriptors()
 	{
-		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+		auto layout = m_Layout;
+		auto pool = m_Pool;
 
-		constexpr const uint32_t framesInFlight = (uint32_t)RendererSpecification::BufferCount;
+		// Note(Jorben): The resources are kept alive until the sets are destroyed
+		auto images = m_Images.Resources;
+		auto buffers = m_StorageBuffers.Resources;
 
-		std::vector<VkDescriptorSet> descriptorSets = { };
-		std::vector<VkDescriptorSetLayout> layouts((size_t)framesInFlight * amount, m_DescriptorLayouts[setID]);
+		Renderer::SubmitFree([layout, pool, images, buffers]()
+		{
+			auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
 
-		VkDescriptorSetAllocateInfo allocInfo = {};
-		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-		allocInfo.descriptorPool = m_DescriptorPools[setID];
-		allocInfo.descriptorSetCount = framesInFlight * amount;
-		allocInfo.pSetLayouts = layouts.data();
+			if (pool != VK_NULL_HANDLE)
+				vkDestroyDescriptorPool(device, pool, nullptr);
+			if (layout != VK_NULL_HANDLE)
+				vkDestroyDescriptorSetLayout(device, layout, nullptr);
+		});
+	}
 
-		descriptorSets.resize((size_t)framesInFlight * amount);
+	uint32_t VulkanBindlessDescriptors::AddImage(const Ref<Image2D>& image)
+	{
+		APP_PROFILE_SCOPE("VulkanBindlessDescriptors::AddImage");
+
+		if (!IsValid())
+		{
+			APP_LOG_ERROR("Tried to add an image to invalid bindless descriptors.");
+			return m_Specification.MaxImages;
+		}
+
+		uint32_t index = m_Images.Acquire(image, m_Specification.MaxImages);
+		if (index == m_Specification.MaxImages)
+		{
+			APP_LOG_ERROR("Exceeded the maximum amount of bindless images ({0}).", m_Specification.MaxImages);
+			return index;
+		}
+
+		auto vkImage = RefHelper::RefAs<VulkanImage2D>(image);
+
+		VkDescriptorImageInfo imageInfo = {};
+		imageInfo.imageLayout = (VkImageLayout)vkImage->GetSpecification().Layout;
+		imageInfo.imageView = vkImage->GetImageView();
 
-		VkResult res = vkAllocateDescriptorSets(device, &allocInfo, descriptorSets.data());
-		if (res != VK_SUCCESS)
-			APP_LOG_ERROR("Failed to allocate descriptor sets! Error: {0}", VkResultToString(res));
+		VkDescriptorImageInfo samplerInfo = {};
+		samplerInfo.sampler = vkImage->GetSampler();
 
-		ConvertToVulkanDescriptorSets(setID, amount, descriptorSets);
+		std::vector<VkWriteDescriptorSet> descriptorWrites = { };
+		descriptorWrites.reserve(m_Sets.size() * 2);
+
+		for (auto& set : m_Sets)
+		{
+			VkWriteDescriptorSet imageWrite = {};
+			imageWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			imageWrite.dstSet = set;
+			imageWrite.dstBinding = 0;
+			imageWrite.dstArrayElement = index;
+			imageWrite.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+			imageWrite.descriptorCount = 1;
+			imageWrite.pImageInfo = &imageInfo;
+
+			VkWriteDescriptorSet samplerWrite = imageWrite;
+			samplerWrite.dstBinding = 1;
+			samplerWrite.descriptorType = VK_DESCRIPTOR_TYPE_SAMPLER;
+			samplerWrite.pImageInfo = &samplerInfo;
+
+			descriptorWrites.push_back(imageWrite);
+			descriptorWrites.push_back(samplerWrite);
+		}
+
+		vkUpdateDescriptorSets(((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice(), (uint32_t)descriptorWrites.size(), descriptorWrites.data(), 0, nullptr);
+		Renderer::GetCurrentRenderData().DescriptorWrites += (uint32_t)descriptorWrites.size();
+		return index;
 	}
 
-	void VulkanDescriptorSets::ConvertToVulkanDescriptorSets(Descriptor::SetID setID, uint32_t amount, std::vector<VkDescriptorSet>& sets)
+	uint32_t VulkanBindlessDescriptors::AddStorageBuffer(const Ref<StorageBuffer>& buffer)
 	{
-		m_DescriptorSets[setID].resize((size_t)amount);
+		APP_PROFILE_SCOPE("VulkanBindlessDescriptors::AddStorageBuffer");
 
+		if (!IsValid())
+		{
+			APP_LOG_ERROR("Tried to add a storage buffer to invalid bindless descriptors.");
+			return m_Specification.MaxStorageBuffers;
+		}
+
+		uint32_t index = m_StorageBuffers.Acquire(buffer, m_Specification.MaxStorageBuffers);
+		if (index == m_Specification.MaxStorageBuffers)
+		{
+			APP_LOG_ERROR("Exceeded the maximum amount of bindless storage buffers ({0}).", m_Specification.MaxStorageBuffers);
+			return index;
+		}
+
+		auto vkBuffer = RefHelper::RefAs<VulkanStorageBuffer>(buffer);
+
+		std::vector<VkDescriptorBufferInfo> bufferInfos(m_Sets.size());
+		std::vector<VkWriteDescriptorSet> descriptorWrites(m_Sets.size());
+
+		// Note(Jorben): Storage buffers have a buffer for every frame in flight, just like the sets
+		for (size_t i = 0; i < m_Sets.size(); i++)
+		{
+			bufferInfos[i].buffer = vkBuffer->GetVulkanBuffer((uint32_t)i);
+			bufferInfos[i].offset = 0;
+			bufferInfos[i].range = vkBuffer->GetSize();
+
+			descriptorWrites[i].sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrites[i].dstSet = m_Sets[i];
+			descriptorWrites[i].dstBinding = 2;
+			descriptorWrites[i].dstArrayElement = index;
+			descriptorWrites[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+			descriptorWrites[i].descriptorCount = 1;
+			descriptorWrites[i].pBufferInfo = &bufferInfos[i];
+		}
+
+		vkUpdateDescriptorSets(((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice(), (uint32_t)descriptorWrites.size(), descriptorWrites.data(), 0, nullptr);
+		Renderer::GetCurrentRenderData().DescriptorWrites += (uint32_t)descriptorWrites.size();
+		return index;
+	}
+
+	void VulkanBindlessDescriptors::RemoveImage(uint32_t index)
+	{
+		if (!IsValid())
+			return;
+
+		m_Images.Release(index);
+	}
+
+	void VulkanBindlessDescriptors::RemoveStorageBuffer(uint32_t index)
+	{
+		if (!IsValid())
+			return;
+
+		m_StorageBuffers.Release(index);
+	}
+
+	void VulkanBindlessDescriptors::Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint)
+	{
+		APP_PROFILE_SCOPE("VulkanBindlessDescriptors::Bind");
+
+		if (!IsValid())
+			return;
+
+		auto vkPipelineLayout = RefHelper::RawAs<VulkanPipeline>(pipeline)->GetVulkanLayout();
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+
+		cmdBuf->BindDescriptorSet(PipelineBindPointToVulkanBindPoint(bindPoint), vkPipelineLayout, m_Specification.Set, m_Sets[Renderer::GetCurrentFrame()]);
+	}
+
+	void VulkanBindlessDescriptors::CreateDescriptorSetLayout()
+	{
+		constexpr const VkShaderStageFlags stages = VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT | VK_SHADER_STAGE_COMPUTE_BIT;
+
+		std::array<VkDescriptorSetLayoutBinding, 3> layouts = { };
+		layouts[0] = { 0, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, m_Specification.MaxImages, stages, nullptr };
+		layouts[1] = { 1, VK_DESCRIPTOR_TYPE_SAMPLER, m_Specification.MaxImages, stages, nullptr };
+		layouts[2] = { 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, m_Specification.MaxStorageBuffers, stages, nullptr };
+
+		// Note(Jorben): Not every index has to be valid, only the ones actually accessed by the shader
+		constexpr const VkDescriptorBindingFlags flags = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+		std::array<VkDescriptorBindingFlags, 3> bindingFlags = { flags, flags, flags };
+
+		VkDescriptorSetLayoutBindingFlagsCreateInfo flagsInfo = {};
+		flagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+		flagsInfo.bindingCount = (uint32_t)bindingFlags.size();
+		flagsInfo.pBindingFlags = bindingFlags.data();
+
+		VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+		layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+		layoutInfo.pNext = &flagsInfo;
+		layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+		layoutInfo.bindingCount = (uint32_t)layouts.size();
+		layoutInfo.pBindings = layouts.data();
+
+		if (vkCreateDescriptorSetLayout(((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice(), &layoutInfo, nullptr, &m_Layout) != VK_SUCCESS)
+			APP_LOG_ERROR("Failed to create bindless descriptor set layout!");
+	}
+
+	void VulkanBindlessDescriptors::CreateDescriptorSets()
+	{
 		constexpr const uint32_t framesInFlight = (uint32_t)RendererSpecification::BufferCount;
 
-		uint32_t index = 0;
-		for (uint32_t i = 0; i < amount; i++)
+		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+
+		std::array<VkDescriptorPoolSize, 3> poolSizes = { };
+		poolSizes[0] = { VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, m_Specification.MaxImages * framesInFlight };
+		poolSizes[1] = { VK_DESCRIPTOR_TYPE_SAMPLER, m_Specification.MaxImages * framesInFlight };
+		poolSizes[2] = { VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, m_Specification.MaxStorageBuffers * framesInFlight };
+
+		VkDescriptorPoolCreateInfo poolInfo = {};
+		poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+		poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+		poolInfo.poolSizeCount = (uint32_t)poolSizes.size();
+		poolInfo.pPoolSizes = poolSizes.data();
+		poolInfo.maxSets = framesInFlight;
+
+		if (vkCreateDescriptorPool(device, &poolInfo, nullptr, &m_Pool) != VK_SUCCESS)
 		{
-			std::vector<VkDescriptorSet> setCombo = { };
+			APP_LOG_ERROR("Failed to create bindless descriptor pool!");
+			return;
+		}
 
-			for (uint32_t j = 0; j < framesInFlight; j++)
-				setCombo.push_back(sets[index + j]);
+		std::vector<VkDescriptorSetLayout> layouts((size_t)framesInFlight, m_Layout);
 
-			m_DescriptorSets[setID][i] = RefHelper::Create<VulkanDescriptorSet>(setID, setCombo);
-			index += framesInFlight;
+		VkDescriptorSetAllocateInfo allocInfo = {};
+		allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocInfo.descriptorPool = m_Pool;
+		allocInfo.descriptorSetCount = framesInFlight;
+		allocInfo.pSetLayouts = layouts.data();
+
+		m_Sets.resize((size_t)framesInFlight);
+		if (vkAllocateDescriptorSets(device, &allocInfo, m_Sets.data()) != VK_SUCCESS)
+		{
+			APP_LOG_ERROR("Failed to allocate bindless descriptor sets!");
+			m_Sets.clear();
 		}
 	}
 
+	template<typename T>
+	uint32_t VulkanBindlessDescriptors::Slots<T>::Acquire(const Ref<T>& resource, uint32_t max)
+	{
+		constexpr const uint64_t framesInFlight = (uint64_t)RendererSpecification::BufferCount;
+		uint64_t frame = ((VulkanRenderer*)Renderer::GetInstance())->GetSwapChain()->GetFrameCount();
+
+		for (auto it = PendingIndices.begin(); it != PendingIndices.end();)
+		{
+			if (it->Frame + framesInFlight <= frame)
+			{
+				Resources[it->Index] = nullptr;
+				FreeIndices.push_back(it->Index);
+				it = PendingIndices.erase(it);
+			}
+			else
+			{
+				it++;
+			}
+		}
+
+		uint32_t index = max;
+		if (!FreeIndices.empty())
+		{
+			index = FreeIndices.back();
+			FreeIndices.pop_back();
+		}
+		else if (Next < max)
+		{
+			index = Next++;
+		}
+		else
+		{
+			return max;
+		}
+
+		Resources[index] = resource;
+		return index;
+	}
+
+	template<typename T>
+	void VulkanBindlessDescriptors::Slots<T>::Release(uint32_t index)
+	{
+		bool pending = std::find_if(PendingIndices.begin(), PendingIndices.end(), [index](const PendingSlot& slot) { return slot.Index == index; }) != PendingIndices.end();
+		if (index >= (uint32_t)Resources.size() || !Resources[index] || pending)
+		{
+			APP_LOG_ERROR("Tried to remove invalid bindless index: {0}", index);
+			return;
+		}
+
+		// Note(Jorben): The resource stays referenced until the index is actually reused
+		PendingIndices.push_back({ index, ((VulkanRenderer*)Renderer::GetInstance())->GetSwapChain()->GetFrameCount() });
+	}
 
 
 	VkDescriptorType DescriptorTypeToVulkanDescriptorType(DescriptorType type)
@@ -5,36 +5,46 @@
 
 #include "Swift/Renderer/Descriptors.hpp"
 
+#include "Swift/Vulkan/VulkanDescriptorWriter.hpp"
+
 #include <Vulkan/vulkan.h>
 
 namespace Swift
 {
 
 	class VulkanPipeline;
+	class VulkanDescriptorAllocator;
 
 	VkDescriptorType DescriptorTypeToVulkanDescriptorType(DescriptorType type);
 
-	class VulkanDescriptorSet : public DescriptorSet
+	class VulkanDescriptorSet final : public DescriptorSet
 	{
 	public:
-		VulkanDescriptorSet(Descriptor::SetID setID, const std::vector<VkDescriptorSet>& sets);
-		virtual ~VulkanDescriptorSet() = default;
+		VulkanDescriptorSet(Descriptor::SetID setID, const std::vector<VkDescriptorSet>& sets, Ref<VulkanDescriptorAllocator> allocator = nullptr, bool transient = false);
+		virtual ~VulkanDescriptorSet();
 
-		void Bind(Ref<Pipeline> pipeline, Ref<CommandBuffer> commandBuffer, PipelineBindPoint bindPoint, const std::vector<uint32_t>& dynamicOffsets) override;
+		void Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint, const std::vector<uint32_t>& dynamicOffsets) override;
+		void Flush() override;
 
 		inline Descriptor::SetID GetSetID() const { return m_SetID; }
 		inline VkDescriptorSet GetVulkanSet(uint32_t index) { return m_Sets[index]; }
+		inline VulkanDescriptorWriter& GetWriter(uint32_t index) { return m_Writers[m_Transient ? 0 : index]; }
 	
-		static Ref<DescriptorSet> Create(Descriptor::SetID setID, const std::vector<VkDescriptorSet>& sets);
+		static Ref<DescriptorSet> Create(Descriptor::SetID setID, const std::vector<VkDescriptorSet>& sets, Ref<VulkanDescriptorAllocator> allocator = nullptr, bool transient = false);
 
 	private:
 		Descriptor::SetID m_SetID = 0;
 
 		// Note(Jorben): One for every frame in flight
 		std::vector<VkDescriptorSet> m_Sets = { };
+		std::vector<VulkanDescriptorWriter> m_Writers = { }; // Note(Jorben): Transient sets only have one, since every frame index points to the same set
+
+		// Note(Jorben): The sets get returned to the allocator on destruction, except for transient sets.
+		Ref<VulkanDescriptorAllocator> m_Allocator = nullptr;
+		bool m_Transient = false;
 	};
 
-	class VulkanDescriptorSets : public DescriptorSets
+	class VulkanDescriptorSets final : public DescriptorSets
 	{
 	public:
 		VulkanDescriptorSets(const std::initializer_list<AmountGroup>& sets);
@@ -46,20 +56,79 @@ namespace Swift
 		DescriptorSetLayout& GetLayout(Descriptor::SetID setID) override;
 		std::vector<Ref<DescriptorSet>>& GetSets(Descriptor::SetID setID) override;
 
+		Ref<DescriptorSet> AllocateTransient(Descriptor::SetID setID) override;
+
 	private:
 		void CreateDescriptorSetLayout(Descriptor::SetID setID);
-		void CreateDescriptorPool(Descriptor::SetID setID, uint32_t amount);
 		void CreateDescriptorSets(Descriptor::SetID setID, uint32_t amount);
-		void ConvertToVulkanDescriptorSets(Descriptor::SetID setID, uint32_t amount, std::vector<VkDescriptorSet>& sets);
 
 	private:
 		Dict<Descriptor::SetID, DescriptorSetLayout> m_OriginalLayouts = { };
 		Dict<Descriptor::SetID, std::vector<Ref<DescriptorSet>>> m_DescriptorSets = { };
 
 		Dict<Descriptor::SetID, VkDescriptorSetLayout> m_DescriptorLayouts = { };
-		Dict<Descriptor::SetID, VkDescriptorPool> m_DescriptorPools = { };
+		Dict<Descriptor::SetID, Ref<VulkanDescriptorAllocator>> m_Allocators = { };
 
 		friend class VulkanPipeline;
 	};
 
+	class VulkanBindlessDescriptors final : public BindlessDescriptors
+	{
+	public:
+		VulkanBindlessDescriptors(const BindlessSpecification& specs);
+		virtual ~VulkanBindlessDescriptors();
+
+		uint32_t AddImage(const Ref<Image2D>& image) override;
+		uint32_t AddStorageBuffer(const Ref<StorageBuffer>& buffer) override;
+
+		void RemoveImage(uint32_t index) override;
+		void RemoveStorageBuffer(uint32_t index) override;
+
+		void Bind(const Ref<Pipeline>& pipeline, const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint) override;
+
+		inline const BindlessSpecification& GetSpecification() const override { return m_Specification; }
+
+		inline VkDescriptorSetLayout GetVulkanLayout() const { return m_Layout; }
+		// Note(Jorben): False when the device doesn't support bindless descriptors (or creation failed), every operation is a no-op then.
+		inline bool IsValid() const { return m_Layout != VK_NULL_HANDLE && !m_Sets.empty(); }
+
+	private:
+		void CreateDescriptorSetLayout();
+		void CreateDescriptorSets();
+
+	private:
+		// Note(Jorben): Keeps track of which indices of one binding array are in use.
+		template<typename T>
+		struct Slots
+		{
+		public:
+			struct PendingSlot
+			{
+			public:
+				uint32_t Index = 0;
+				uint64_t Frame = 0; // Note(Jorben): The frame count at which the slot was removed
+			};
+
+			std::vector<Ref<T>> Resources = { };
+			std::vector<uint32_t> FreeIndices = { };
+			std::vector<PendingSlot> PendingIndices = { };
+			uint32_t Next = 0;
+
+			uint32_t Acquire(const Ref<T>& resource, uint32_t max);
+			void Release(uint32_t index);
+		};
+
+	private:
+		BindlessSpecification m_Specification = {};
+
+		VkDescriptorSetLayout m_Layout = VK_NULL_HANDLE;
+		VkDescriptorPool m_Pool = VK_NULL_HANDLE;
+
+		// Note(Jorben): One for every frame in flight
+		std::vector<VkDescriptorSet> m_Sets = { };
+
+		Slots<Image2D> m_Images = {};
+		Slots<StorageBuffer> m_StorageBuffers = {};
+	};
+
 }
\ No newline at end of file
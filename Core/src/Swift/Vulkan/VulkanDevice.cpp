@@ -32,13 +32,54 @@ namespace Swift
 		deviceFeatures.fillModeNonSolid = VK_TRUE;
 		deviceFeatures.wideLines = VK_TRUE;
 
+		// Note(Jorben): The extended dynamic state extensions & descriptor indexing are optional, we only enable what the device supports
+		const DynamicStateSupport& dynamicSupport = m_PhysicalDevice->GetDynamicStateSupport();
+		std::vector<const char*> extensions = s_RequestedDeviceExtensions;
+		void* featureChain = nullptr;
+
+		VkPhysicalDeviceExtendedDynamicStateFeaturesEXT stateFeatures = {};
+		stateFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+		if (dynamicSupport.ExtendedDynamicState)
+		{
+			stateFeatures.extendedDynamicState = VK_TRUE;
+			stateFeatures.pNext = featureChain;
+			featureChain = &stateFeatures;
+			extensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+		}
+
+		VkPhysicalDeviceExtendedDynamicState3FeaturesEXT state3Features = {};
+		state3Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+		if (dynamicSupport.PolygonMode || dynamicSupport.ColourBlendEnable)
+		{
+			state3Features.extendedDynamicState3PolygonMode = dynamicSupport.PolygonMode;
+			state3Features.extendedDynamicState3ColorBlendEnable = dynamicSupport.ColourBlendEnable;
+			state3Features.pNext = featureChain;
+			featureChain = &state3Features;
+			extensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
+		}
+
+		VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures = {};
+		indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+		if (m_PhysicalDevice->GetBindlessSupport().Supported)
+		{
+			indexingFeatures.runtimeDescriptorArray = VK_TRUE;
+			indexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+			indexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+			indexingFeatures.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+			indexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+			indexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+			indexingFeatures.pNext = featureChain;
+			featureChain = &indexingFeatures;
+		}
+
 		VkDeviceCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+		createInfo.pNext = featureChain;
 		createInfo.queueCreateInfoCount = static_cast<uint32_t>(queueCreateInfos.size());
 		createInfo.pQueueCreateInfos = queueCreateInfos.data();
 		createInfo.pEnabledFeatures = &deviceFeatures;
-		createInfo.enabledExtensionCount = static_cast<uint32_t>(s_RequestedDeviceExtensions.size());
-		createInfo.ppEnabledExtensionNames = s_RequestedDeviceExtensions.data();
+		createInfo.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+		createInfo.ppEnabledExtensionNames = extensions.data();
 
 		if constexpr (s_Validation)
 		{
@@ -57,6 +98,18 @@ namespace Swift
 		vkGetDeviceQueue(m_LogicalDevice, indices.GraphicsFamily.value(), 0, &m_GraphicsQueue);
 		vkGetDeviceQueue(m_LogicalDevice, indices.ComputeFamily.value(), 0, &m_ComputeQueue);
 		vkGetDeviceQueue(m_LogicalDevice, indices.PresentFamily.value(), 0, &m_PresentQueue);
+
+		// Retrieve the dynamic state functions
+		if (dynamicSupport.ExtendedDynamicState)
+		{
+			m_DynamicStateFunctions.CmdSetCullMode = (PFN_vkCmdSetCullModeEXT)vkGetDeviceProcAddr(m_LogicalDevice, "vkCmdSetCullModeEXT");
+			m_DynamicStateFunctions.CmdSetDepthTestEnable = (PFN_vkCmdSetDepthTestEnableEXT)vkGetDeviceProcAddr(m_LogicalDevice, "vkCmdSetDepthTestEnableEXT");
+			m_DynamicStateFunctions.CmdSetDepthWriteEnable = (PFN_vkCmdSetDepthWriteEnableEXT)vkGetDeviceProcAddr(m_LogicalDevice, "vkCmdSetDepthWriteEnableEXT");
+		}
+		if (dynamicSupport.PolygonMode)
+			m_DynamicStateFunctions.CmdSetPolygonMode = (PFN_vkCmdSetPolygonModeEXT)vkGetDeviceProcAddr(m_LogicalDevice, "vkCmdSetPolygonModeEXT");
+		if (dynamicSupport.ColourBlendEnable)
+			m_DynamicStateFunctions.CmdSetColorBlendEnable = (PFN_vkCmdSetColorBlendEnableEXT)vkGetDeviceProcAddr(m_LogicalDevice, "vkCmdSetColorBlendEnableEXT");
 	}
 
 	VulkanDevice::~VulkanDevice()
@@ -12,6 +12,17 @@
 namespace Swift
 {
 
+	// Note(Jorben): Loaded from the device, a function is nullptr when the matching DynamicStateSupport is false.
+	struct DynamicStateFunctions
+	{
+	public:
+		PFN_vkCmdSetCullModeEXT CmdSetCullMode = nullptr;
+		PFN_vkCmdSetDepthTestEnableEXT CmdSetDepthTestEnable = nullptr;
+		PFN_vkCmdSetDepthWriteEnableEXT CmdSetDepthWriteEnable = nullptr;
+		PFN_vkCmdSetPolygonModeEXT CmdSetPolygonMode = nullptr;
+		PFN_vkCmdSetColorBlendEnableEXT CmdSetColorBlendEnable = nullptr;
+	};
+
 	class VulkanDevice
 	{
 	public:
@@ -25,6 +36,7 @@ namespace Swift
 		inline VkQueue& GetPresentQueue() { return m_PresentQueue; }
 
 		inline Ref<VulkanPhysicalDevice> GetPhysicalDevice() const { return m_PhysicalDevice; }
+		inline const DynamicStateFunctions& GetDynamicStateFunctions() const { return m_DynamicStateFunctions; }
 
 		static Ref<VulkanDevice> Create(Ref<VulkanPhysicalDevice> physicalDevice);
 
@@ -35,6 +47,8 @@ namespace Swift
 		VkQueue m_GraphicsQueue = VK_NULL_HANDLE;
 		VkQueue m_ComputeQueue = VK_NULL_HANDLE;
 		VkQueue m_PresentQueue = VK_NULL_HANDLE;
+
+		DynamicStateFunctions m_DynamicStateFunctions = {};
 	};
 
 }
\ No newline at end of file
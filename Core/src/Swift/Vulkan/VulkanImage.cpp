@@ -8,6 +8,7 @@
 
 #include "Swift/Vulkan/VulkanUtils.hpp"
 #include "Swift/Vulkan/VulkanRenderer.hpp"
+#include "Swift/Vulkan/VulkanProfiler.hpp"
 #include "Swift/Vulkan/VulkanPipeline.hpp"
 #include "Swift/Vulkan/VulkanDescriptors.hpp"
 
@@ -80,6 +81,7 @@ namespace Swift
 		VulkanAllocator::MapMemory(stagingBufferAllocation, mappedData);
 		memcpy(mappedData, data, size);
 		VulkanAllocator::UnMapMemory(stagingBufferAllocation);
+		Renderer::GetCurrentRenderData().UploadedBytes += size;
 
 		VulkanAllocator::TransitionImageLayout(m_Data.Image, GetVulkanFormatFromImageFormat(m_Specification.Format), VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, m_Miplevels);
 		allocator.CopyBufferToImage(stagingBuffer, m_Data.Image, m_Specification.Width, m_Specification.Height);
@@ -113,34 +115,24 @@ namespace Swift
 				allocator.DestroyImage(data.Image, data.Allocation);
 		});
 
+		m_ResourceID = VulkanDescriptorWriter::NextResourceID();
 		CreateImage(width, height);
 	}
 
-	void VulkanImage2D::Upload(Ref<DescriptorSet> set, Descriptor element)
+	void VulkanImage2D::Upload(const Ref<DescriptorSet>& set, Descriptor element)
 	{
 		APP_PROFILE_SCOPE("VulkanImage2D::Upload");
 
-		auto vkSet = RefHelper::RefAs<VulkanDescriptorSet>(set);
+		auto vkSet = RefHelper::RawAs<VulkanDescriptorSet>(set);
+
+		VkDescriptorImageInfo imageInfo = {};
+		imageInfo.imageLayout = (VkImageLayout)m_Specification.Layout;
+		imageInfo.imageView = m_Data.ImageView;
+		imageInfo.sampler = m_Data.Sampler;
 
 		constexpr const size_t framesInFlight = (size_t)RendererSpecification::BufferCount;
 		for (size_t i = 0; i < framesInFlight; i++)
-		{
-			VkDescriptorImageInfo imageInfo = {};
-			imageInfo.imageLayout = (VkImageLayout)m_Specification.Layout;
-			imageInfo.imageView = m_Data.ImageView;
-			imageInfo.sampler = m_Data.Sampler;
-
-			VkWriteDescriptorSet descriptorWrite = {};
-			descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-			descriptorWrite.dstSet = vkSet->GetVulkanSet((uint32_t)i);
-			descriptorWrite.dstBinding = element.Binding;
-			descriptorWrite.dstArrayElement = 0;
-			descriptorWrite.descriptorType = DescriptorTypeToVulkanDescriptorType(element.Type);
-			descriptorWrite.descriptorCount = element.Count;
-			descriptorWrite.pImageInfo = &imageInfo;
-
-			vkUpdateDescriptorSets(((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice(), 1, &descriptorWrite, 0, nullptr);
-		}
+			vkSet->GetWriter((uint32_t)i).WriteImage(element.Binding, DescriptorTypeToVulkanDescriptorType(element.Type), imageInfo, m_ResourceID);
 	}
 
 	void VulkanImage2D::Transition(ImageLayout initial, ImageLayout final)
@@ -153,6 +145,7 @@ namespace Swift
 	{
 		m_Specification = specs;
 		m_Data = data;
+		m_ResourceID = VulkanDescriptorWriter::NextResourceID();
 	}
 
 	VkFormat VulkanImage2D::GetFormat() const
@@ -225,6 +218,9 @@ namespace Swift
 		barrier.subresourceRange.layerCount = 1;
 		barrier.subresourceRange.levelCount = 1;
 
+		VulkanGPUZone zone = {};
+		APP_PROFILE_GPU_BEGIN(zone, ((VulkanRenderer*)Renderer::GetInstance())->GetProfilerContext(), command.GetVulkanCommandBuffer(), "GenerateMipmaps");
+
 		int32_t mipWidth = texWidth;
 		int32_t mipHeight = texHeight;
 
@@ -288,6 +284,9 @@ namespace Swift
 			0, nullptr,
 			0, nullptr,
 			1, &barrier);
+		APP_PROFILE_GPU_END(zone);
+
+		Renderer::GetCurrentRenderData().Barriers += (mipLevels - 1) * 2 + 1;
 
 		command.EndAndSubmit();
 	}
@@ -7,6 +7,8 @@
 #include "Swift/Renderer/Pipeline.hpp"
 #include "Swift/Renderer/Descriptors.hpp"
 
+#include "Swift/Vulkan/VulkanDescriptorWriter.hpp"
+
 #include <vulkan/vulkan.h>
 #include <vk_mem_alloc.h>
 
@@ -31,7 +33,7 @@ namespace Swift
 		virtual ~VulkanImageData() = default;
 	};
 
-	class VulkanImage2D : public Image2D
+	class VulkanImage2D final : public Image2D
 	{
 	public:
 		VulkanImage2D(const ImageSpecification& specs);
@@ -42,7 +44,7 @@ namespace Swift
 
 		void Resize(uint32_t width, uint32_t height) override;
 
-		void Upload(Ref<DescriptorSet> set, Descriptor element) override;
+		void Upload(const Ref<DescriptorSet>& set, Descriptor element) override;
 		void Transition(ImageLayout initial, ImageLayout final) override;
 
 		// Helper function for swapchain
@@ -73,6 +75,8 @@ namespace Swift
 		VulkanImageData m_Data = {};
 
 		uint32_t m_Miplevels = 1;
+
+		uint64_t m_ResourceID = VulkanDescriptorWriter::NextResourceID(); // Note(Jorben): Changes when the handles get recreated
 	};
 
 }
\ No newline at end of file
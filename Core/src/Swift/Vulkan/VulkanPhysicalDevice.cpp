@@ -35,6 +35,9 @@ namespace Swift
 		m_Depthformat = GetDepthFormat();
 
 		vkGetPhysicalDeviceProperties(m_PhysicalDevice, &m_Properties);
+		m_DynamicState = DynamicStateSupport::Query(m_PhysicalDevice);
+		m_Bindless = BindlessSupport::Query(m_PhysicalDevice);
+		m_Timestamps = TimestampSupport::Query(m_PhysicalDevice, m_Properties);
 
 		// Note(Jorben): Check if no device was selected
 		APP_VERIFY(m_PhysicalDevice, "Verify failed: Failed to find suitable GPU");
@@ -68,11 +71,20 @@ namespace Swift
 			if (queueFamily.queueFlags & VK_QUEUE_COMPUTE_BIT)
 				indices.ComputeFamily = i;
 
-			VkBool32 presentSupport = false;
+			// Note(Jorben): Headless mode has no surface to present to, so the graphics queue doubles as the present queue
 			VkSurfaceKHR& surface = ((VulkanRenderer*)Renderer::GetInstance())->GetVulkanSurface();
-			vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
-			if (presentSupport)
-				indices.PresentFamily = i;
+			if (surface == VK_NULL_HANDLE)
+			{
+				if (indices.GraphicsFamily.has_value())
+					indices.PresentFamily = indices.GraphicsFamily;
+			}
+			else
+			{
+				VkBool32 presentSupport = false;
+				vkGetPhysicalDeviceSurfaceSupportKHR(device, i, surface, &presentSupport);
+				if (presentSupport)
+					indices.PresentFamily = i;
+			}
 
 			i++;
 		}
@@ -112,6 +124,93 @@ namespace Swift
 		return details;
 	}
 
+	DynamicStateSupport DynamicStateSupport::Query(const VkPhysicalDevice& device)
+	{
+		DynamicStateSupport support = {};
+
+		uint32_t extensionCount;
+		vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, nullptr);
+
+		std::vector<VkExtensionProperties> availableExtensions(extensionCount);
+		vkEnumerateDeviceExtensionProperties(device, nullptr, &extensionCount, availableExtensions.data());
+
+		bool hasState = false, hasState2 = false, hasState3 = false;
+		for (const auto& extension : availableExtensions)
+		{
+			if (strcmp(extension.extensionName, VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME) == 0)
+				hasState = true;
+			else if (strcmp(extension.extensionName, VK_EXT_EXTENDED_DYNAMIC_STATE_2_EXTENSION_NAME) == 0)
+				hasState2 = true;
+			else if (strcmp(extension.extensionName, VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME) == 0)
+				hasState3 = true;
+		}
+
+		VkPhysicalDeviceExtendedDynamicState3FeaturesEXT state3Features = {};
+		state3Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+
+		VkPhysicalDeviceExtendedDynamicState2FeaturesEXT state2Features = {};
+		state2Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
+		state2Features.pNext = hasState3 ? &state3Features : nullptr;
+
+		VkPhysicalDeviceExtendedDynamicStateFeaturesEXT stateFeatures = {};
+		stateFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT;
+		stateFeatures.pNext = &state2Features;
+
+		VkPhysicalDeviceFeatures2 features = {};
+		features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+		features.pNext = &stateFeatures;
+		vkGetPhysicalDeviceFeatures2(device, &features);
+
+		support.ExtendedDynamicState = hasState && stateFeatures.extendedDynamicState;
+		support.ExtendedDynamicState2 = hasState2 && state2Features.extendedDynamicState2;
+		support.PolygonMode = hasState3 && state3Features.extendedDynamicState3PolygonMode;
+		support.ColourBlendEnable = hasState3 && state3Features.extendedDynamicState3ColorBlendEnable;
+
+		return support;
+	}
+
+	BindlessSupport BindlessSupport::Query(const VkPhysicalDevice& device)
+	{
+		BindlessSupport support = {};
+
+		VkPhysicalDeviceDescriptorIndexingFeatures indexingFeatures = {};
+		indexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
+
+		VkPhysicalDeviceFeatures2 features = {};
+		features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+		features.pNext = &indexingFeatures;
+		vkGetPhysicalDeviceFeatures2(device, &features);
+
+		support.Supported = indexingFeatures.runtimeDescriptorArray && indexingFeatures.descriptorBindingPartiallyBound
+			&& indexingFeatures.shaderSampledImageArrayNonUniformIndexing && indexingFeatures.shaderStorageBufferArrayNonUniformIndexing
+			&& indexingFeatures.descriptorBindingSampledImageUpdateAfterBind && indexingFeatures.descriptorBindingStorageBufferUpdateAfterBind;
+
+		return support;
+	}
+
+	TimestampSupport TimestampSupport::Query(const VkPhysicalDevice& device, const VkPhysicalDeviceProperties& properties)
+	{
+		TimestampSupport support = {};
+
+		QueueFamilyIndices indices = QueueFamilyIndices::Find(device);
+		if (!indices.GraphicsFamily.has_value())
+			return support;
+
+		uint32_t queueFamilyCount = 0;
+		vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, nullptr);
+
+		std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+		vkGetPhysicalDeviceQueueFamilyProperties(device, &queueFamilyCount, queueFamilies.data());
+
+		uint32_t validBits = queueFamilies[indices.GraphicsFamily.value()].timestampValidBits;
+
+		support.Supported = properties.limits.timestampComputeAndGraphics && validBits > 0;
+		support.Period = properties.limits.timestampPeriod;
+		support.Mask = (validBits >= 64 ? MAX_UINT64 : ((1ull << validBits) - 1));
+
+		return support;
+	}
+
 	bool VulkanPhysicalDevice::PhysicalDeviceSuitable(const VkPhysicalDevice& device)
 	{
 		QueueFamilyIndices indices = QueueFamilyIndices::Find(device);
@@ -119,7 +218,11 @@ namespace Swift
 		bool extensionsSupported = ExtensionsSupported(device);
 		bool swapChainAdequate = false;
 
-		if (extensionsSupported)
+		if (extensionsSupported && Application::Get().IsHeadless())
+		{
+			swapChainAdequate = true;
+		}
+		else if (extensionsSupported)
 		{
 			SwapChainSupportDetails swapChainSupport = SwapChainSupportDetails::Query(device);
 			swapChainAdequate = !swapChainSupport.Formats.empty() && !swapChainSupport.PresentModes.empty();
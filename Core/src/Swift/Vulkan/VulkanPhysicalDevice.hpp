@@ -2,6 +2,7 @@
 
 #include <stdint.h>
 #include <memory>
+#include <optional>
 
 #include <vulkan/vulkan.h>
 
@@ -34,6 +35,38 @@ namespace Swift
 		static SwapChainSupportDetails Query(const VkPhysicalDevice& device);
 	};
 
+	// Note(Jorben): Which parts of VK_EXT_extended_dynamic_state(2/3) the selected device can do.
+	struct DynamicStateSupport
+	{
+	public:
+		bool ExtendedDynamicState = false;	// Culling mode, depth test & depth write
+		bool ExtendedDynamicState2 = false;
+		bool PolygonMode = false;			// VK_EXT_extended_dynamic_state3
+		bool ColourBlendEnable = false;		// VK_EXT_extended_dynamic_state3
+
+		static DynamicStateSupport Query(const VkPhysicalDevice& device);
+	};
+
+	// Note(Jorben): Whether the descriptor indexing features needed for bindless descriptors are supported (core in Vulkan 1.2).
+	struct BindlessSupport
+	{
+	public:
+		bool Supported = false;
+
+		static BindlessSupport Query(const VkPhysicalDevice& device);
+	};
+
+	// Note(Jorben): Whether timestamp queries can be written on the graphics & compute queues and how to convert them.
+	struct TimestampSupport
+	{
+	public:
+		bool Supported = false;
+		float Period = 0.0f;	// Nanoseconds per tick
+		uint64_t Mask = 0;		// Only the valid bits of the graphics queue's timestamps
+
+		static TimestampSupport Query(const VkPhysicalDevice& device, const VkPhysicalDeviceProperties& properties);
+	};
+
 	class VulkanPhysicalDevice
 	{
 	public:
@@ -44,6 +77,9 @@ namespace Swift
 
 		inline VkFormat GetDepthFormat() const { return m_Depthformat; }
 		inline const VkPhysicalDeviceProperties& GetProperties() { return m_Properties; }
+		inline const DynamicStateSupport& GetDynamicStateSupport() const { return m_DynamicState; }
+		inline const BindlessSupport& GetBindlessSupport() const { return m_Bindless; }
+		inline const TimestampSupport& GetTimestampSupport() const { return m_Timestamps; }
 
 		static Ref<VulkanPhysicalDevice> Select();
 
@@ -57,6 +93,10 @@ namespace Swift
 		
 		VkPhysicalDeviceProperties m_Properties = {};
 		VkFormat m_Depthformat = VK_FORMAT_UNDEFINED;
+
+		DynamicStateSupport m_DynamicState = {};
+		BindlessSupport m_Bindless = {};
+		TimestampSupport m_Timestamps = {};
 	};
 
 }
\ No newline at end of file
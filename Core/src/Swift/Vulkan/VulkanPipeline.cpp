@@ -19,7 +19,20 @@ namespace Swift
 	VulkanPipeline::VulkanPipeline(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<Shader> shader, Ref<RenderPass> renderpass)
 		: m_Specification(specs), m_Sets(sets), m_Shader(shader), m_RenderPass(renderpass)
 	{
-		CreateGraphicsPipeline();
+		const DynamicStateSupport& support = ((VulkanRenderer*)Renderer::GetInstance())->GetPhysicalDevice()->GetDynamicStateSupport();
+
+		PipelineDynamicState supported = PipelineDynamicState::None;
+		if (support.ExtendedDynamicState)
+			supported = supported | PipelineDynamicState::CullingMode | PipelineDynamicState::DepthTest | PipelineDynamicState::DepthWrite;
+		if (support.PolygonMode)
+			supported = supported | PipelineDynamicState::PolygonMode;
+		if (support.ColourBlendEnable)
+			supported = supported | PipelineDynamicState::Blending;
+
+		m_DynamicState = (PipelineDynamicState)((uint8_t)m_Specification.DynamicState & (uint8_t)supported);
+		m_State = { m_Specification.Cullingmode, m_Specification.Polygonmode, m_Specification.DepthTest, m_Specification.DepthWrite, m_Specification.Blending };
+
+		m_GraphicsPipeline = GetOrCreatePipeline(m_State);
 	}
 
 	VulkanPipeline::VulkanPipeline(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<ComputeShader> shader)
@@ -30,26 +43,175 @@ namespace Swift
 
 	VulkanPipeline::~VulkanPipeline()
 	{
-		auto pipeline = m_GraphicsPipeline;
+		std::vector<VkPipeline> pipelines = { };
+		if (m_Pipelines.empty())
+			pipelines.push_back(m_GraphicsPipeline);
+		for (auto& pair : m_Pipelines)
+			pipelines.push_back(pair.second);
+
 		auto layout = m_PipelineLayout;
 
-		Renderer::SubmitFree([pipeline, layout]()
+		Renderer::SubmitFree([pipelines, layout]()
 		{
 			auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
 
-			vkDestroyPipeline(device, pipeline, nullptr);
+			for (auto& pipeline : pipelines)
+				vkDestroyPipeline(device, pipeline, nullptr);
 			vkDestroyPipelineLayout(device, layout, nullptr);
 		});
 	}
 
-	void VulkanPipeline::Use(Ref<CommandBuffer> commandBuffer, PipelineBindPoint bindPoint)
+	void VulkanPipeline::Use(const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint)
+	{
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+
+		if (bindPoint != PipelineBindPoint::Graphics || m_ComputeShader)
+		{
+			cmdBuf->BindPipeline(PipelineBindPointToVulkanBindPoint(bindPoint), m_GraphicsPipeline);
+			return;
+		}
+
+		// Note(Jorben): Every Use() starts from the specification's state, the Set* functions override it until the next Use()
+		m_State = { m_Specification.Cullingmode, m_Specification.Polygonmode, m_Specification.DepthTest, m_Specification.DepthWrite, m_Specification.Blending };
+		BindCurrentState(cmdBuf);
+	}
+
+	void VulkanPipeline::SetCullingMode(const Ref<CommandBuffer>& commandBuffer, CullingMode mode)
+	{
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+		auto vkCmdBuf = cmdBuf->GetVulkanCommandBuffer(Renderer::GetCurrentFrame());
+		m_State.Cullingmode = mode;
+
+		if (m_DynamicState & PipelineDynamicState::CullingMode)
+		{
+			auto& functions = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetDynamicStateFunctions();
+			functions.CmdSetCullMode(vkCmdBuf, (VkCullModeFlags)mode);
+		}
+		else
+		{
+			cmdBuf->BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, GetOrCreatePipeline(m_State));
+		}
+	}
+
+	void VulkanPipeline::SetPolygonMode(const Ref<CommandBuffer>& commandBuffer, PolygonMode mode)
+	{
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+		auto vkCmdBuf = cmdBuf->GetVulkanCommandBuffer(Renderer::GetCurrentFrame());
+		m_State.Polygonmode = mode;
+
+		if (m_DynamicState & PipelineDynamicState::PolygonMode)
+		{
+			auto& functions = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetDynamicStateFunctions();
+			functions.CmdSetPolygonMode(vkCmdBuf, (VkPolygonMode)mode);
+		}
+		else
+		{
+			cmdBuf->BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, GetOrCreatePipeline(m_State));
+		}
+	}
+
+	void VulkanPipeline::SetDepthState(const Ref<CommandBuffer>& commandBuffer, bool test, bool write)
+	{
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+		auto vkCmdBuf = cmdBuf->GetVulkanCommandBuffer(Renderer::GetCurrentFrame());
+		m_State.DepthTest = test;
+		m_State.DepthWrite = write;
+
+		auto& functions = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetDynamicStateFunctions();
+		if (m_DynamicState & PipelineDynamicState::DepthTest)
+			functions.CmdSetDepthTestEnable(vkCmdBuf, test);
+		if (m_DynamicState & PipelineDynamicState::DepthWrite)
+			functions.CmdSetDepthWriteEnable(vkCmdBuf, write);
+
+		if (!(m_DynamicState & PipelineDynamicState::DepthTest) || !(m_DynamicState & PipelineDynamicState::DepthWrite))
+			cmdBuf->BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, GetOrCreatePipeline(m_State));
+	}
+
+	void VulkanPipeline::SetBlending(const Ref<CommandBuffer>& commandBuffer, bool enabled)
+	{
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+		auto vkCmdBuf = cmdBuf->GetVulkanCommandBuffer(Renderer::GetCurrentFrame());
+		m_State.Blending = enabled;
+
+		if (m_DynamicState & PipelineDynamicState::Blending)
+		{
+			auto& functions = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetDynamicStateFunctions();
+
+			VkBool32 enable = enabled;
+			functions.CmdSetColorBlendEnable(vkCmdBuf, 0, 1, &enable);
+		}
+		else
+		{
+			cmdBuf->BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, GetOrCreatePipeline(m_State));
+		}
+	}
+
+	void VulkanPipeline::PushConstants(const Ref<CommandBuffer>& commandBuffer, const void* data, uint32_t size, uint32_t offset)
 	{
-		auto cmdBuf = RefHelper::RefAs<VulkanCommandBuffer>(commandBuffer);
+		APP_ASSERT((offset + size <= m_Specification.PushConstantSize), "Push constant range exceeds the size specified in the pipeline specification.");
 
-		vkCmdBindPipeline(cmdBuf->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()), PipelineBindPointToVulkanBindPoint(bindPoint), m_GraphicsPipeline);
+		auto vkCmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer)->GetVulkanCommandBuffer(Renderer::GetCurrentFrame());
+		vkCmdPushConstants(vkCmdBuf, m_PipelineLayout, m_PushConstantStages, offset, size, data);
 	}
 
-	void VulkanPipeline::CreateGraphicsPipeline()
+	void VulkanPipeline::CreatePipelineLayout(VkShaderStageFlags pushConstantStages)
+	{
+		// Note(Jorben): Set layouts have to be ordered by their set ID, the bindless set takes up its own ID
+		std::map<Descriptor::SetID, VkDescriptorSetLayout> orderedLayouts = { };
+
+		if (m_Sets)
+		{
+			for (auto& pair : RefHelper::RefAs<VulkanDescriptorSets>(m_Sets)->m_DescriptorLayouts)
+				orderedLayouts[pair.first] = pair.second;
+		}
+		if (m_Specification.Bindless)
+		{
+			auto bindless = RefHelper::RefAs<VulkanBindlessDescriptors>(m_Specification.Bindless);
+			if (!bindless->IsValid())
+			{
+				APP_LOG_ERROR("The pipeline's bindless descriptors are invalid, the bindless set is left out of the pipeline layout.");
+			}
+			else
+			{
+				if (orderedLayouts.contains(bindless->GetSpecification().Set))
+					APP_LOG_ERROR("Bindless descriptor set ID {0} is already used by the pipeline's descriptor sets.", bindless->GetSpecification().Set);
+
+				orderedLayouts[bindless->GetSpecification().Set] = bindless->GetVulkanLayout();
+			}
+		}
+
+		std::vector<VkDescriptorSetLayout> descriptorLayouts = { };
+		descriptorLayouts.reserve(orderedLayouts.size());
+
+		for (auto& pair : orderedLayouts)
+		{
+			if (pair.first != (Descriptor::SetID)descriptorLayouts.size())
+				APP_LOG_ERROR("Descriptor set IDs must be contiguous and start at 0, found set ID {0}.", pair.first);
+
+			descriptorLayouts.push_back(pair.second);
+		}
+
+		VkPushConstantRange pushConstantRange = {};
+		pushConstantRange.stageFlags = pushConstantStages;
+		pushConstantRange.offset = 0;
+		pushConstantRange.size = m_Specification.PushConstantSize;
+
+		m_PushConstantStages = pushConstantStages;
+
+		VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		pipelineLayoutInfo.pushConstantRangeCount = (m_Specification.PushConstantSize > 0 ? 1 : 0);
+		pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+		pipelineLayoutInfo.setLayoutCount = (uint32_t)descriptorLayouts.size();
+		pipelineLayoutInfo.pSetLayouts = descriptorLayouts.data();
+
+		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
+
+		if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
+			APP_LOG_ERROR("Failed to create pipeline layout!");
+	}
+
+	VkPipeline VulkanPipeline::CreateGraphicsPipeline(const State& state)
 	{
 		auto vkShader = RefHelper::RefAs<VulkanShader>(m_Shader);
 
@@ -112,9 +274,9 @@ namespace Swift
 		rasterizer.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
 		rasterizer.depthClampEnable = VK_FALSE;
 		rasterizer.rasterizerDiscardEnable = VK_FALSE;
-		rasterizer.polygonMode = (VkPolygonMode)(m_Specification.Polygonmode);
+		rasterizer.polygonMode = (VkPolygonMode)(state.Polygonmode);
 		rasterizer.lineWidth = m_Specification.LineWidth;
-		rasterizer.cullMode = (VkCullModeFlags)(m_Specification.Cullingmode);
+		rasterizer.cullMode = (VkCullModeFlags)(state.Cullingmode);
 		rasterizer.frontFace = VK_FRONT_FACE_COUNTER_CLOCKWISE;
 		rasterizer.depthBiasEnable = VK_FALSE;
 
@@ -125,7 +287,7 @@ namespace Swift
 
 		VkPipelineColorBlendAttachmentState colorBlendAttachment = {};
 		colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
-		colorBlendAttachment.blendEnable = m_Specification.Blending; // Note(Jorben): Set true for transparancy
+		colorBlendAttachment.blendEnable = state.Blending; // Note(Jorben): Set true for transparancy
 
 		VkPipelineColorBlendStateCreateInfo colorBlending = {};
 		colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
@@ -140,8 +302,8 @@ namespace Swift
 
 		VkPipelineDepthStencilStateCreateInfo depthStencil = {};
 		depthStencil.sType = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
-		depthStencil.depthTestEnable = VK_TRUE;
-		depthStencil.depthWriteEnable = VK_TRUE;
+		depthStencil.depthTestEnable = state.DepthTest;
+		depthStencil.depthWriteEnable = state.DepthWrite;
 		depthStencil.depthCompareOp = VK_COMPARE_OP_LESS;
 		depthStencil.depthBoundsTestEnable = VK_FALSE;
 		depthStencil.minDepthBounds = 0.0f; // Optional
@@ -155,30 +317,27 @@ namespace Swift
 			VK_DYNAMIC_STATE_SCISSOR
 		};
 
+		if (m_DynamicState & PipelineDynamicState::CullingMode)
+			dynamicStates.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
+		if (m_DynamicState & PipelineDynamicState::PolygonMode)
+			dynamicStates.push_back(VK_DYNAMIC_STATE_POLYGON_MODE_EXT);
+		if (m_DynamicState & PipelineDynamicState::DepthTest)
+			dynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);
+		if (m_DynamicState & PipelineDynamicState::DepthWrite)
+			dynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT);
+		if (m_DynamicState & PipelineDynamicState::Blending)
+			dynamicStates.push_back(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT);
+
 		VkPipelineDynamicStateCreateInfo dynamicState = {};
 		dynamicState.sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
 		dynamicState.dynamicStateCount = (uint32_t)dynamicStates.size();
 		dynamicState.pDynamicStates = dynamicStates.data();
 
-		// Descriptor layouts
-		auto vkDescriptorSets = RefHelper::RefAs<VulkanDescriptorSets>(m_Sets);
-
-		std::vector<VkDescriptorSetLayout> descriptorLayouts = { };
-		descriptorLayouts.reserve(vkDescriptorSets->m_DescriptorLayouts.size());
-
-		for (auto& pair : vkDescriptorSets->m_DescriptorLayouts)
-			descriptorLayouts.push_back(pair.second);
-
-		VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
-		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-		pipelineLayoutInfo.pushConstantRangeCount = 0;
-		pipelineLayoutInfo.setLayoutCount = (uint32_t)descriptorLayouts.size();
-		pipelineLayoutInfo.pSetLayouts = descriptorLayouts.data();
-
 		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
 
-		if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
-			APP_LOG_ERROR("Failed to create pipeline layout!");
+		// Descriptor layouts (shared by all variants)
+		if (m_PipelineLayout == VK_NULL_HANDLE)
+			CreatePipelineLayout(VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_FRAGMENT_BIT);
 
 		// Create the actual graphics pipeline (where we actually use the shaders and other info)
 		VkGraphicsPipelineCreateInfo pipelineInfo = {};
@@ -199,8 +358,11 @@ namespace Swift
 		pipelineInfo.basePipelineHandle = VK_NULL_HANDLE; // Optional
 		pipelineInfo.basePipelineIndex = -1; // Optional
 
-		if (vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &m_GraphicsPipeline) != VK_SUCCESS)
+		VkPipeline pipeline = VK_NULL_HANDLE;
+		if (vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipelineInfo, nullptr, &pipeline) != VK_SUCCESS)
 			APP_LOG_ERROR("Failed to create graphics pipeline!");
+
+		return pipeline;
 	}
 
 	void VulkanPipeline::CreateComputePipeline()
@@ -213,25 +375,10 @@ namespace Swift
 		computeShaderStageInfo.module = vkComputeShader->GetComputeShader();
 		computeShaderStageInfo.pName = "main";
 
-		auto vkDescriptorSets = RefHelper::RefAs<VulkanDescriptorSets>(m_Sets);
-
-		std::vector<VkDescriptorSetLayout> descriptorLayouts;
-		descriptorLayouts.reserve(vkDescriptorSets->m_DescriptorLayouts.size());
-
-		for (auto& pair : vkDescriptorSets->m_DescriptorLayouts)
-			descriptorLayouts.push_back(pair.second);
-
-		VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
-		pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-		pipelineLayoutInfo.pushConstantRangeCount = 0;
-		pipelineLayoutInfo.setLayoutCount = static_cast<uint32_t>(descriptorLayouts.size());
-		pipelineLayoutInfo.pSetLayouts = descriptorLayouts.data();
+		CreatePipelineLayout(VK_SHADER_STAGE_COMPUTE_BIT);
 
 		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
 
-		if (vkCreatePipelineLayout(device, &pipelineLayoutInfo, nullptr, &m_PipelineLayout) != VK_SUCCESS)
-			APP_LOG_ERROR("Failed to create pipeline layout!");
-
 		VkComputePipelineCreateInfo pipelineInfo = {};
 		pipelineInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
 		pipelineInfo.stage = computeShaderStageInfo;
@@ -277,6 +424,64 @@ namespace Swift
 		return attributeDescriptions;
 	}
 
+	uint32_t VulkanPipeline::GetStateKey(const State& state) const
+	{
+		uint32_t key = 0;
+
+		if (!(m_DynamicState & PipelineDynamicState::CullingMode))
+			key |= BIT_X((uint32_t)state.Cullingmode, 0);
+		if (!(m_DynamicState & PipelineDynamicState::PolygonMode))
+			key |= BIT_X(((uint32_t)state.Polygonmode & 0b11), 2);
+		if (!(m_DynamicState & PipelineDynamicState::DepthTest))
+			key |= BIT_X((uint32_t)state.DepthTest, 4);
+		if (!(m_DynamicState & PipelineDynamicState::DepthWrite))
+			key |= BIT_X((uint32_t)state.DepthWrite, 5);
+		if (!(m_DynamicState & PipelineDynamicState::Blending))
+			key |= BIT_X((uint32_t)state.Blending, 6);
+
+		return key;
+	}
+
+	VkPipeline VulkanPipeline::GetOrCreatePipeline(const State& state)
+	{
+		uint32_t key = GetStateKey(state);
+
+		auto it = m_Pipelines.find(key);
+		if (it != m_Pipelines.end())
+			return it->second;
+
+		VkPipeline pipeline = CreateGraphicsPipeline(state);
+		m_Pipelines[key] = pipeline;
+
+		return pipeline;
+	}
+
+	void VulkanPipeline::BindCurrentState(VulkanCommandBuffer* commandBuffer)
+	{
+		commandBuffer->BindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, GetOrCreatePipeline(m_State));
+
+		if (m_DynamicState == PipelineDynamicState::None)
+			return;
+
+		VkCommandBuffer vkCmdBuf = commandBuffer->GetVulkanCommandBuffer(Renderer::GetCurrentFrame());
+
+		auto& functions = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetDynamicStateFunctions();
+
+		if (m_DynamicState & PipelineDynamicState::CullingMode)
+			functions.CmdSetCullMode(vkCmdBuf, (VkCullModeFlags)m_State.Cullingmode);
+		if (m_DynamicState & PipelineDynamicState::PolygonMode)
+			functions.CmdSetPolygonMode(vkCmdBuf, (VkPolygonMode)m_State.Polygonmode);
+		if (m_DynamicState & PipelineDynamicState::DepthTest)
+			functions.CmdSetDepthTestEnable(vkCmdBuf, m_State.DepthTest);
+		if (m_DynamicState & PipelineDynamicState::DepthWrite)
+			functions.CmdSetDepthWriteEnable(vkCmdBuf, m_State.DepthWrite);
+		if (m_DynamicState & PipelineDynamicState::Blending)
+		{
+			VkBool32 enable = m_State.Blending;
+			functions.CmdSetColorBlendEnable(vkCmdBuf, 0, 1, &enable);
+		}
+	}
+
 	static VkFormat DataTypeToVulkanType(DataType type)
 	{
 		switch (type)
@@ -17,31 +17,56 @@ namespace Swift
 {
 
 	class VulkanDescriptorSets;
+	class VulkanCommandBuffer;
 
 	VkPipelineBindPoint PipelineBindPointToVulkanBindPoint(PipelineBindPoint bindPoint);
 
-	class VulkanPipeline : public Pipeline
+	class VulkanPipeline final : public Pipeline
 	{
 	public:
 		VulkanPipeline(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<Shader> shader, Ref<RenderPass> renderpass);
 		VulkanPipeline(PipelineSpecification specs, Ref<DescriptorSets> sets, Ref<ComputeShader> shader);
 		virtual ~VulkanPipeline();
 
-		void Use(Ref<CommandBuffer> commandBuffer, PipelineBindPoint bindPoint) override;
+		void Use(const Ref<CommandBuffer>& commandBuffer, PipelineBindPoint bindPoint) override;
+
+		void SetCullingMode(const Ref<CommandBuffer>& commandBuffer, CullingMode mode) override;
+		void SetPolygonMode(const Ref<CommandBuffer>& commandBuffer, PolygonMode mode) override;
+		void SetDepthState(const Ref<CommandBuffer>& commandBuffer, bool test, bool write) override;
+		void SetBlending(const Ref<CommandBuffer>& commandBuffer, bool enabled) override;
+
+		void PushConstants(const Ref<CommandBuffer>& commandBuffer, const void* data, uint32_t size, uint32_t offset) override;
 
 		inline PipelineSpecification& GetSpecification() override { return m_Specification; };
-		inline Ref<DescriptorSets> GetDescriptorSets() override { return m_Sets; }
+		inline const Ref<DescriptorSets>& GetDescriptorSets() override { return m_Sets; }
 
 		inline VkPipelineLayout GetVulkanLayout() { return m_PipelineLayout; }
 
 	private:
-		void CreateGraphicsPipeline();
+		struct State
+		{
+		public:
+			CullingMode Cullingmode = CullingMode::Front;
+			PolygonMode Polygonmode = PolygonMode::Fill;
+			bool DepthTest = true;
+			bool DepthWrite = true;
+			bool Blending = false;
+		};
+
+	private:
+		void CreatePipelineLayout(VkShaderStageFlags pushConstantStages);
+		VkPipeline CreateGraphicsPipeline(const State& state);
 		void CreateComputePipeline();
 		void CreateRayTracingPipeline(); // TODO: Implement
 
 		VkVertexInputBindingDescription GetBindingDescription();
 		std::vector<VkVertexInputAttributeDescription> GetAttributeDescriptions();
 
+		// Note(Jorben): Only the non-dynamic state is part of the key, since dynamic state doesn't require a different pipeline.
+		uint32_t GetStateKey(const State& state) const;
+		VkPipeline GetOrCreatePipeline(const State& state);
+		void BindCurrentState(VulkanCommandBuffer* commandBuffer);
+
 	private:
 		Ref<Shader> m_Shader = nullptr;
 		Ref<ComputeShader> m_ComputeShader = nullptr;
@@ -52,6 +77,11 @@ namespace Swift
 
 		VkPipeline m_GraphicsPipeline = VK_NULL_HANDLE;
 		VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+		VkShaderStageFlags m_PushConstantStages = 0;
+
+		PipelineDynamicState m_DynamicState = PipelineDynamicState::None; // Note(Jorben): The requested dynamic state which is supported by the device
+		State m_State = {};
+		Dict<uint32_t, VkPipeline> m_Pipelines = { };
 
 		friend class VulkanDescriptorSets;
 	};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <optional>
+
+#include "Swift/Utils/Profiler.hpp"
+
+#include <vulkan/vulkan.h>
+#include <tracy/TracyVulkan.hpp>
+
+#if !defined(APP_DIST) && APP_ENABLE_PROFILING && !APP_ENABLE_TRACING && defined(TRACY_ENABLE)
+	#define APP_GPU_PROFILING 1
+#else
+	#define APP_GPU_PROFILING 0
+#endif
+
+namespace Swift
+{
+
+	typedef TracyVkCtx VulkanProfilerContext;
+
+	// Note(Jorben): A GPU zone that can be started and stopped in different functions, like VulkanRenderPass::Begin() & VulkanRenderPass::End().
+	class VulkanGPUZone
+	{
+	public:
+		VulkanGPUZone() = default;
+		virtual ~VulkanGPUZone() = default;
+
+	#if APP_GPU_PROFILING
+		inline void Begin(VulkanProfilerContext context, const tracy::SourceLocationData* location, VkCommandBuffer commandBuffer) { m_Scope.reset(); m_Scope.emplace(context, location, commandBuffer, context != nullptr); }
+		inline void End() { m_Scope.reset(); }
+
+	private:
+		std::optional<tracy::VkCtxScope> m_Scope = {};
+	#endif
+	};
+
+}
+
+#if APP_GPU_PROFILING
+
+// Note(Jorben): The context has to be created after the swapchain, since it records a calibration command.
+#define APP_PROFILE_GPU_CONTEXT(physicalDevice, device, queue, commandBuffer) tracy::CreateVkContext(physicalDevice, device, queue, commandBuffer, nullptr, nullptr)
+#define APP_PROFILE_GPU_DESTROY(context) if (context) tracy::DestroyVkContext(context)
+
+// Note(Jorben): Collect isn't thread safe, so only call it from the thread that records the frame's commandbuffers.
+#define APP_PROFILE_GPU_COLLECT(context, commandBuffer) if (context) context->Collect(commandBuffer)
+
+#define APP_PROFILE_GPU_SCOPE(context, commandBuffer, name) TracyVkNamedZone(context, ___tracy_gpu_zone, commandBuffer, name, context != nullptr)
+#define APP_PROFILE_GPU_BEGIN(zone, context, commandBuffer, name) \
+	{ \
+		static constexpr tracy::SourceLocationData TracyConcat(__app_gpu_source_location, TracyLine) { name, TracyFunction, TracyFile, (uint32_t)TracyLine, 0 }; \
+		zone.Begin(context, &TracyConcat(__app_gpu_source_location, TracyLine), commandBuffer); \
+	}
+#define APP_PROFILE_GPU_END(zone) zone.End()
+
+#else
+
+#define APP_PROFILE_GPU_CONTEXT(physicalDevice, device, queue, commandBuffer) nullptr
+#define APP_PROFILE_GPU_DESTROY(context)
+
+#define APP_PROFILE_GPU_COLLECT(context, commandBuffer)
+
+#define APP_PROFILE_GPU_SCOPE(context, commandBuffer, name)
+#define APP_PROFILE_GPU_BEGIN(zone, context, commandBuffer, name)
+#define APP_PROFILE_GPU_END(zone)
+
+#endif
\ No newline at end of file
@@ -34,8 +34,11 @@ namespace Swift
     void VulkanRenderPass::Begin()
     {
         m_CommandBuffer->Begin();
+        m_CommandBuffer->BeginTimer(m_Specification.Name);
 
         auto renderer = (VulkanRenderer*)Renderer::GetInstance();
+        APP_PROFILE_GPU_BEGIN(m_GPUZone, renderer->GetProfilerContext(), m_CommandBuffer->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()), "RenderPass");
+
         VkExtent2D extent = { Application::Get().GetWindow().GetWidth(), Application::Get().GetWindow().GetHeight() };
 
         VkRenderPassBeginInfo renderPassInfo = {};
@@ -69,18 +72,20 @@ namespace Swift
         viewport.height = (float)extent.height;
         viewport.minDepth = 0.0f;
         viewport.maxDepth = 1.0f;
-        vkCmdSetViewport(m_CommandBuffer->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()), 0, 1, &viewport);
+        m_CommandBuffer->SetViewport(viewport);
 
         VkRect2D scissor = {};
         scissor.offset = { 0, 0 };
         scissor.extent = extent;
-        vkCmdSetScissor(m_CommandBuffer->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()), 0, 1, &scissor);
+        m_CommandBuffer->SetScissor(scissor);
     }
 
     void VulkanRenderPass::End()
     {
         auto renderer = (VulkanRenderer*)Renderer::GetInstance();
         vkCmdEndRenderPass(m_CommandBuffer->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()));
+        APP_PROFILE_GPU_END(m_GPUZone);
+        m_CommandBuffer->EndTimer();
 
         m_CommandBuffer->End();
     }
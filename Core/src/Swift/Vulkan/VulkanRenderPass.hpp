@@ -8,6 +8,7 @@
 #include "Swift/Renderer/RenderPass.hpp"
 #include "Swift/Renderer/CommandBuffer.hpp"
 
+#include "Swift/Vulkan/VulkanProfiler.hpp"
 #include "Swift/Vulkan/VulkanCommandBuffer.hpp"
 
 #include <vulkan/vulkan.h>
@@ -15,7 +16,7 @@
 namespace Swift
 {
 
-	class VulkanRenderPass : public RenderPass
+	class VulkanRenderPass final : public RenderPass
 	{
 	public:
 		VulkanRenderPass(RenderPassSpecification specs, Ref<CommandBuffer> commandBuffer);
@@ -44,6 +45,8 @@ namespace Swift
 
 		VkRenderPass m_RenderPass = VK_NULL_HANDLE;
 		std::vector<VkFramebuffer> m_Framebuffers = { };
+
+		VulkanGPUZone m_GPUZone = {}; // Note(Jorben): Spans from Begin() to End()
 	};
 
 }
\ No newline at end of file
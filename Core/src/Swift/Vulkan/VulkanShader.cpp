@@ -6,10 +6,16 @@
 #include "Swift/Renderer/Renderer.hpp"
 
 #include "Swift/Vulkan/VulkanRenderer.hpp"
+#include "Swift/Vulkan/VulkanProfiler.hpp"
 #include "Swift/Vulkan/VulkanCommandBuffer.hpp"
 
 #include <shaderc/shaderc.hpp>
 
+// Note(Jorben): Newer SDKs ship glslang's version header next to shaderc's
+#if __has_include(<glslang/build_info.h>)
+	#include <glslang/build_info.h>
+#endif
+
 namespace Swift
 {
 
@@ -33,13 +39,44 @@ namespace Swift
 		return shaderc_glsl_vertex_shader;
 	}
 
-	std::vector<char> VulkanShaderCompiler::Compile(const std::string& code, ShaderStage stage)
+	static shaderc_optimization_level ShaderOptimizationToShaderCLevel(ShaderOptimization optimization)
+	{
+		switch (optimization)
+		{
+		case ShaderOptimization::Debug:
+			return shaderc_optimization_level_zero;
+		case ShaderOptimization::Performance:
+			return shaderc_optimization_level_performance;
+		case ShaderOptimization::Size:
+			return shaderc_optimization_level_size;
+
+		default:
+			APP_LOG_ERROR("Invalid shader optimization passed in.");
+			break;
+		}
+
+		return shaderc_optimization_level_zero;
+	}
+
+	std::vector<char> VulkanShaderCompiler::Compile(const std::string& code, ShaderStage stage, const ShaderCompileOptions& options, const std::string& name)
 	{
-		shaderc::Compiler compiler = {};
-		shaderc::CompileOptions options = {};
-		options.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
+		// Note(Jorben): A compiler is expensive to create, so we keep one per (worker) thread, see m_Workers
+		thread_local shaderc::Compiler compiler = {};
+
+		auto start = std::chrono::high_resolution_clock::now();
+
+		shaderc::CompileOptions compileOptions = {};
+		compileOptions.SetTargetEnvironment(shaderc_target_env_vulkan, shaderc_env_version_vulkan_1_2);
+		compileOptions.SetOptimizationLevel(ShaderOptimizationToShaderCLevel(options.Optimization));
 
-		shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(code, ShaderStageToShaderCType(stage), "", options);
+		// Note(Jorben): When optimizing without debug info shaderc also strips the debug instructions
+		if (options.Optimization == ShaderOptimization::Debug)
+			compileOptions.SetGenerateDebugInfo();
+
+		for (auto& [define, value] : options.Defines)
+			compileOptions.AddMacroDefinition(define, value);
+
+		shaderc::SpvCompilationResult module = compiler.CompileGlslToSpv(code, ShaderStageToShaderCType(stage), name.c_str(), compileOptions);
 
 		if (module.GetCompilationStatus() != shaderc_compilation_status_success)
 			APP_ASSERT(false, "Error compiling shader: {0}", module.GetErrorMessage());
@@ -50,6 +87,17 @@ namespace Swift
 		const size_t sizeInBytes = numWords * sizeof(uint32_t);
 		const char* bytes = reinterpret_cast<const char*>(data);
 
+		ShaderCompileReport report = {};
+		report.Name = name;
+		report.Stage = stage;
+		report.Optimization = options.Optimization;
+		report.Size = sizeInBytes;
+		report.Time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		{
+			std::scoped_lock<std::mutex> lock(m_ReportMutex);
+			m_Reports.push_back(report);
+		}
+
 		return std::vector<char>(bytes, bytes + sizeInBytes);
 	}
 
@@ -61,6 +109,93 @@ namespace Swift
 		return code;
 	}
 
+	std::vector<std::vector<char>> VulkanShaderCompiler::CompileBatch(const std::vector<ShaderCompileJob>& jobs, std::function<void(size_t index, const std::vector<char>& code)> onCompleted)
+	{
+		std::vector<std::vector<char>> results(jobs.size());
+		std::mutex callbackMutex = {};
+
+		auto compile = [&](size_t i)
+		{
+			results[i] = Compile(jobs[i].Code, jobs[i].Stage, jobs[i].Options, jobs[i].Name);
+
+			if (onCompleted)
+			{
+				std::scoped_lock<std::mutex> lock(callbackMutex);
+				onCompleted(i, results[i]);
+			}
+		};
+
+		std::scoped_lock<std::mutex> lock(m_WorkerMutex);
+
+		// Note(Jorben): The calling thread also takes jobs, so we need one worker less than there are hardware threads
+		if (!m_Workers)
+		{
+			uint32_t workers = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+			if (workers > 0)
+				m_Workers = std::make_unique<Utils::ThreadPool>(workers);
+		}
+
+		if (m_Workers && jobs.size() > 1)
+		{
+			m_Workers->Dispatch(jobs.size(), compile);
+		}
+		else
+		{
+			for (size_t i = 0; i < jobs.size(); i++)
+				compile(i);
+		}
+
+		return results;
+	}
+
+	std::vector<ShaderCompileReport> VulkanShaderCompiler::GetReports()
+	{
+		std::scoped_lock<std::mutex> lock(m_ReportMutex);
+		return m_Reports;
+	}
+
+	void VulkanShaderCompiler::LogReports()
+	{
+		static constexpr const char* s_Optimizations[] = { "Debug", "Performance", "Size" };
+
+		auto reports = GetReports();
+
+		size_t totalSize = 0;
+		double totalTime = 0.0;
+		for (auto& report : reports)
+		{
+			APP_LOG_INFO("Shader '{0}' ({1}): {2} bytes, compiled in {3:.2f}ms", report.Name, s_Optimizations[(size_t)report.Optimization], report.Size, report.Time);
+
+			totalSize += report.Size;
+			totalTime += report.Time;
+		}
+
+		APP_LOG_INFO("Compiled {0} shader(s): {1} bytes total, {2:.2f}ms total compile time", reports.size(), totalSize, totalTime);
+	}
+
+	std::string VulkanShaderCompiler::GetVersion()
+	{
+		// Note(Jorben): shaderc doesn't report its own version, only the SPIR-V version it outputs. So we use the version of
+		// the SDK it came with (the headers we were built against) & glslang's version when available, that way upgrading
+		// the compiler invalidates the cache even if the SPIR-V version stays the same.
+		static const std::string version = []()
+		{
+			unsigned int spvVersion = 0, spvRevision = 0;
+			shaderc_get_spv_version(&spvVersion, &spvRevision);
+
+			std::string sdk = fmt::format("sdk{0}.{1}.{2}", VK_API_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE), VK_API_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE), VK_HEADER_VERSION);
+		#if defined(GLSLANG_VERSION_MAJOR)
+			std::string glslang = fmt::format("-glslang{0}.{1}.{2}", GLSLANG_VERSION_MAJOR, GLSLANG_VERSION_MINOR, GLSLANG_VERSION_PATCH);
+		#else
+			std::string glslang = {};
+		#endif
+
+			return fmt::format("shaderc-{0}{1}-spv{2}.{3}-vulkan1.2", sdk, glslang, spvVersion, spvRevision);
+		}();
+
+		return version;
+	}
+
 
 
 	VulkanShader::VulkanShader(ShaderSpecification code)
@@ -71,6 +206,14 @@ namespace Swift
 			m_FragmentShader = CreateShaderModule(code.Fragment);
 	}
 
+	VulkanShader::VulkanShader(ShaderBlob vertex, ShaderBlob fragment)
+	{
+		if (!vertex.Empty())
+			m_VertexShader = CreateShaderModule(vertex);
+		if (!fragment.Empty())
+			m_FragmentShader = CreateShaderModule(fragment);
+	}
+
 	VulkanShader::~VulkanShader()
 	{
 		auto fragmentShader = m_FragmentShader;
@@ -86,13 +229,19 @@ namespace Swift
 	}
 
 	VkShaderModule VulkanShader::CreateShaderModule(const std::vector<char>& data)
+	{
+		ShaderBlob blob = { reinterpret_cast<const uint32_t*>(data.data()), data.size() };
+		return CreateShaderModule(blob);
+	}
+
+	VkShaderModule VulkanShader::CreateShaderModule(ShaderBlob blob)
 	{
 		auto device = ((VulkanRenderer*)Renderer::GetInstance())->GetLogicalDevice()->GetVulkanDevice();
 
 		VkShaderModuleCreateInfo createInfo = {};
 		createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-		createInfo.codeSize = data.size();
-		createInfo.pCode = reinterpret_cast<const uint32_t*>(data.data());
+		createInfo.codeSize = blob.Size;
+		createInfo.pCode = blob.Data;
 
 		VkShaderModule shaderModule = VK_NULL_HANDLE;
 		if (vkCreateShaderModule(device, &createInfo, nullptr, &shaderModule) != VK_SUCCESS)
@@ -107,6 +256,12 @@ namespace Swift
 			m_ComputeShader = VulkanShader::CreateShaderModule(code.Compute);
 	}
 
+	VulkanComputeShader::VulkanComputeShader(ShaderBlob compute)
+	{
+		if (!compute.Empty())
+			m_ComputeShader = VulkanShader::CreateShaderModule(compute);
+	}
+
 	VulkanComputeShader::~VulkanComputeShader()
 	{
 		auto computeShader = m_ComputeShader;
@@ -119,11 +274,13 @@ namespace Swift
 		});
 	}
 
-	void VulkanComputeShader::Dispatch(Ref<CommandBuffer> commandBuffer, uint32_t width, uint32_t height, uint32_t depth)
+	void VulkanComputeShader::Dispatch(const Ref<CommandBuffer>& commandBuffer, uint32_t width, uint32_t height, uint32_t depth)
 	{
-		auto vkCommand = RefHelper::RefAs<VulkanCommandBuffer>(commandBuffer);
+		auto vkCommand = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+		VkCommandBuffer vkCmdBuf = vkCommand->GetVulkanCommandBuffer(Renderer::GetCurrentFrame());
 
-		vkCmdDispatch(vkCommand->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()), width, height, depth);
+		APP_PROFILE_GPU_SCOPE(((VulkanRenderer*)Renderer::GetInstance())->GetProfilerContext(), vkCmdBuf, "Dispatch");
+		vkCmdDispatch(vkCmdBuf, width, height, depth);
 	}
 
 }
\ No newline at end of file
@@ -2,44 +2,64 @@
 
 #include "Swift/Renderer/Shader.hpp"
 
+#include "Swift/Utils/ThreadPool.hpp"
+
 #include <vulkan/vulkan.h>
 
 namespace Swift
 {
 
-	class VulkanShaderCompiler : public ShaderCompiler
+	class VulkanShaderCompiler final : public ShaderCompiler
 	{
 	public:
 		VulkanShaderCompiler() = default;
 		virtual ~VulkanShaderCompiler() = default;
 
-		std::vector<char> Compile(const std::string& code, ShaderStage stage);
+		std::vector<char> Compile(const std::string& code, ShaderStage stage, const ShaderCompileOptions& options = {}, const std::string& name = "");
 		ShaderSpecification Compile(const std::string& fragment, const std::string& vertex);
+
+		std::vector<std::vector<char>> CompileBatch(const std::vector<ShaderCompileJob>& jobs, std::function<void(size_t index, const std::vector<char>& code)> onCompleted = nullptr);
+
+		std::vector<ShaderCompileReport> GetReports();
+		void LogReports();
+
+		std::string GetVersion();
+
+	private:
+		std::mutex m_ReportMutex = {};
+		std::vector<ShaderCompileReport> m_Reports = { };
+
+		// Note(Jorben): Created on the first batch and kept alive, so every worker keeps its (thread_local) shaderc::Compiler between batches
+		std::mutex m_WorkerMutex = {}; // Note(Jorben): Only one batch can use the workers at a time
+		std::unique_ptr<Utils::ThreadPool> m_Workers = nullptr;
 	};
 
-	class VulkanShader : public Shader
+	class VulkanShader final : public Shader
 	{
 	public:
 		VulkanShader(ShaderSpecification code);
+		VulkanShader(ShaderBlob vertex, ShaderBlob fragment);
 		virtual ~VulkanShader();
 
 		inline VkShaderModule& GetVertexShader() { return m_VertexShader; }
 		inline VkShaderModule& GetFragmentShader() { return m_FragmentShader; }
 
 		static VkShaderModule CreateShaderModule(const std::vector<char>& data);
+		static VkShaderModule CreateShaderModule(ShaderBlob blob);
 
 	private:
 		VkShaderModule m_VertexShader = VK_NULL_HANDLE;
 		VkShaderModule m_FragmentShader = VK_NULL_HANDLE;
 	};
 
-	class VulkanComputeShader : public ComputeShader
+	class VulkanComputeShader final : public ComputeShader
 	{
 	public:
 		VulkanComputeShader(ShaderSpecification code);
+		VulkanComputeShader(ShaderBlob compute);
 		virtual ~VulkanComputeShader();
 
-		void Dispatch(Ref<CommandBuffer> commandBuffer, uint32_t width, uint32_t height, uint32_t depth) override;
+		void Dispatch(const Ref<CommandBuffer>& commandBuffer, uint32_t width, uint32_t height, uint32_t depth) override;
 
 		inline VkShaderModule& GetComputeShader() { return m_ComputeShader; }
 
@@ -17,7 +17,7 @@ namespace Swift
 {
 
 	VulkanSwapChain::VulkanSwapChain(VkInstance vkInstance, Ref<VulkanDevice> vkDevice)
-		: m_Instance(vkInstance), m_Device(vkDevice)
+		: m_Instance(vkInstance), m_Device(vkDevice), m_Headless(Application::Get().IsHeadless())
 	{
 		FindImageFormatAndColorSpace();
 	}
@@ -42,11 +42,23 @@ namespace Swift
 
 	void VulkanSwapChain::BeginFrame()
 	{
+		if (m_Headless)
+		{
+			m_AquiredImage = m_CurrentFrame;
+			return;
+		}
+
 		m_AquiredImage = AcquireNextImage();
 	}
 
 	void VulkanSwapChain::EndFrame()
 	{
+		if (m_Headless)
+		{
+			EndOffscreenFrame();
+			return;
+		}
+
 		auto& semaphores = VulkanTaskManager::GetSemaphores();
 
 		VkPresentInfoKHR presentInfo = {};
@@ -84,6 +96,37 @@ namespace Swift
 
 		constexpr const uint32_t framesInFlight = (uint32_t)RendererSpecification::BufferCount;
 		m_CurrentFrame = (m_CurrentFrame + 1) % framesInFlight;
+		m_FrameCount++;
+	}
+
+	void VulkanSwapChain::EndOffscreenFrame()
+	{
+		auto& semaphores = VulkanTaskManager::GetSemaphores();
+
+		// Note(Jorben): Nothing gets presented, but the signaled semaphores still need a wait before they can be signaled again.
+		// An empty submit consumes them, the frame itself is paced by the fences in VulkanRenderer::BeginFrame.
+		if (!semaphores.empty())
+		{
+			APP_PROFILE_SCOPE("QueueSubmit");
+
+			std::vector<VkPipelineStageFlags> waitStages(semaphores.size(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+			VkSubmitInfo submitInfo = {};
+			submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+			submitInfo.waitSemaphoreCount = (uint32_t)semaphores.size();
+			submitInfo.pWaitSemaphores = semaphores.data();
+			submitInfo.pWaitDstStageMask = waitStages.data();
+			submitInfo.commandBufferCount = 0;
+
+			if (vkQueueSubmit(m_Device->GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+				APP_LOG_ERROR("Failed to submit offscreen frame!");
+
+			Renderer::GetCurrentRenderData().Submits++;
+		}
+
+		constexpr const uint32_t framesInFlight = (uint32_t)RendererSpecification::BufferCount;
+		m_CurrentFrame = (m_CurrentFrame + 1) % framesInFlight;
+		m_FrameCount++;
 	}
 
 	void VulkanSwapChain::OnResize(uint32_t width, uint32_t height, const bool vsync)
@@ -96,8 +139,6 @@ namespace Swift
 	void VulkanSwapChain::Init(uint32_t width, uint32_t height, const bool vsync)
 	{
 		VkDevice device = m_Device->GetVulkanDevice();
-		VkPhysicalDevice physicalDevice = m_Device->GetPhysicalDevice()->GetVulkanPhysicalDevice();
-		VkSurfaceKHR& surface = ((VulkanRenderer*)Renderer::GetInstance())->GetVulkanSurface();
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		// Command pools
@@ -119,6 +160,62 @@ namespace Swift
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		// SwapChain 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		if (width == 0 || height == 0)
+			return;
+
+		if (m_Headless)
+			CreateOffscreenImages(width, height);
+		else
+			CreateSwapChain(width, height, vsync);
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		// Depth 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		if (!m_DepthStencil)
+		{
+			ImageSpecification specs = {};
+			specs.Usage = ImageUsage::Size;
+			specs.Format = GetImageFormatFromVulkanFormat(VulkanAllocator::FindDepthFormat());
+			specs.Flags = ImageUsageFlags::Depth | ImageUsageFlags::Sampled /*| ImageUsageFlags::Storage*/ | ImageUsageFlags::NoMipMaps;
+			specs.Width = width;
+			specs.Height = height;
+			specs.Layout = ImageLayout::Depth;
+
+			m_DepthStencil = Image2D::Create(specs);
+		}
+		else
+			m_DepthStencil->Resize(width, height);
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		// Synchronization Objects
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		if (m_ImageAvailableSemaphores.empty())
+		{
+			m_ImageAvailableSemaphores.resize(framesInFlight);
+
+			VkSemaphoreCreateInfo semaphoreInfo = {};
+			semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+			VkFenceCreateInfo fenceInfo = {};
+			fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+			fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+			for (size_t i = 0; i < framesInFlight; i++)
+			{
+				if (vkCreateSemaphore(device, &semaphoreInfo, nullptr, &m_ImageAvailableSemaphores[i]) != VK_SUCCESS)
+				{
+					APP_LOG_ERROR("Failed to create synchronization objects for a frame!");
+				}
+			}
+		}
+	}
+
+	void VulkanSwapChain::CreateSwapChain(uint32_t width, uint32_t height, const bool vsync)
+	{
+		VkDevice device = m_Device->GetVulkanDevice();
+		VkPhysicalDevice physicalDevice = m_Device->GetPhysicalDevice()->GetVulkanPhysicalDevice();
+		VkSurfaceKHR& surface = ((VulkanRenderer*)Renderer::GetInstance())->GetVulkanSurface();
+
 		SwapChainSupportDetails details = SwapChainSupportDetails::Query(physicalDevice);
 
 		VkExtent2D swapchainExtent = {};
@@ -136,9 +233,6 @@ namespace Swift
 			swapchainExtent = details.Capabilities.currentExtent;
 		}
 
-		if (width == 0 || height == 0)
-			return;
-
 		// The VK_PRESENT_MODE_FIFO_KHR mode must always be present as per spec
 		// This mode waits for the vertical blank ("v-sync")
 		VkPresentModeKHR swapchainPresentMode = VK_PRESENT_MODE_FIFO_KHR;
@@ -300,43 +394,32 @@ namespace Swift
 			if (!m_Images[i]) m_Images[i] = RefHelper::Create<VulkanImage2D>(specs, data);
 			else RefHelper::RefAs<VulkanImage2D>(m_Images[i])->SetImageData(specs, data);
 		}
+	}
 
-		if (!m_DepthStencil)
+	void VulkanSwapChain::CreateOffscreenImages(uint32_t width, uint32_t height)
+	{
+		constexpr const uint32_t framesInFlight = (uint32_t)RendererSpecification::BufferCount;
+
+		// Note(Jorben): One image per frame in flight, the previous ones get freed through the renderer once resized
+		if (m_Images.empty())
 		{
+			m_Images.resize((size_t)framesInFlight);
+
 			ImageSpecification specs = {};
 			specs.Usage = ImageUsage::Size;
-			specs.Format = GetImageFormatFromVulkanFormat(VulkanAllocator::FindDepthFormat());
-			specs.Flags = ImageUsageFlags::Depth | ImageUsageFlags::Sampled /*| ImageUsageFlags::Storage*/ | ImageUsageFlags::NoMipMaps;
+			specs.Format = GetImageFormatFromVulkanFormat(m_ColourFormat);
+			specs.Flags = ImageUsageFlags::Colour | ImageUsageFlags::Sampled | ImageUsageFlags::NoMipMaps;
 			specs.Width = width;
 			specs.Height = height;
-			specs.Layout = ImageLayout::Depth;
+			specs.Layout = ImageLayout::Presentation;
 
-			m_DepthStencil = Image2D::Create(specs);
+			for (uint32_t i = 0; i < framesInFlight; i++)
+				m_Images[i] = Image2D::Create(specs);
 		}
 		else
-			m_DepthStencil->Resize(width, height);
-
-		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-		// Synchronization Objects
-		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-		if (m_ImageAvailableSemaphores.empty())
 		{
-			m_ImageAvailableSemaphores.resize(framesInFlight);
-
-			VkSemaphoreCreateInfo semaphoreInfo = {};
-			semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
-
-			VkFenceCreateInfo fenceInfo = {};
-			fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-			fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-
-			for (size_t i = 0; i < framesInFlight; i++)
-			{
-				if (vkCreateSemaphore(device, &semaphoreInfo, nullptr, &m_ImageAvailableSemaphores[i]) != VK_SUCCESS)
-				{
-					APP_LOG_ERROR("Failed to create synchronization objects for a frame!");
-				}
-			}
+			for (auto& image : m_Images)
+				image->Resize(width, height);
 		}
 	}
 
@@ -361,6 +444,13 @@ namespace Swift
 
 	void VulkanSwapChain::FindImageFormatAndColorSpace()
 	{
+		if (m_Headless)
+		{
+			m_ColourFormat = VK_FORMAT_B8G8R8A8_UNORM;
+			m_ColourSpace = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
+			return;
+		}
+
 		VkPhysicalDevice physicalDevice = m_Device->GetPhysicalDevice()->GetVulkanPhysicalDevice();
 		VkSurfaceKHR& surface = ((VulkanRenderer*)Renderer::GetInstance())->GetVulkanSurface();
 
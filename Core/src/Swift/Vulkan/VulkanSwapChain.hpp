@@ -32,6 +32,7 @@ namespace Swift
 		inline VkFormat GetColourFormat() const { return m_ColourFormat; }
 
 		inline uint32_t GetCurrentFrame() const { return m_CurrentFrame; }
+		inline uint64_t GetFrameCount() const { return m_FrameCount; } // Note(Jorben): The amount of presented frames
 		inline uint32_t GetAquiredImage() const { return m_AquiredImage; }
 
 		inline std::vector<Ref<Image2D>>& GetSwapChainImages() { return m_Images; }
@@ -43,10 +44,16 @@ namespace Swift
 
 		inline VkCommandPool& GetCommandPool() { return m_CommandPool; }
 
+		inline bool IsHeadless() const { return m_Headless; }
+
 		static Ref<VulkanSwapChain> Create(VkInstance vkInstance, Ref<VulkanDevice> vkDevice);
 
 	private:
+		void CreateSwapChain(uint32_t width, uint32_t height, const bool vsync);
+		void CreateOffscreenImages(uint32_t width, uint32_t height);
+
 		uint32_t AcquireNextImage();
+		void EndOffscreenFrame();
 		void FindImageFormatAndColorSpace();
 
 	private:
@@ -66,6 +73,9 @@ namespace Swift
 
 		uint32_t m_CurrentFrame = 0;
 		uint32_t m_AquiredImage = 0;
+		uint64_t m_FrameCount = 0;
+
+		bool m_Headless = false; // Note(Jorben): Renders to offscreen images instead of a surface
 	};
 
 }
\ No newline at end of file
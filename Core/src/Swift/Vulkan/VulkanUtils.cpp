@@ -8,6 +8,7 @@
 #include "Swift/Renderer/Renderer.hpp"
 
 #include "Swift/Vulkan/VulkanRenderer.hpp"
+#include "Swift/Vulkan/VulkanProfiler.hpp"
 
 namespace Swift
 {
@@ -65,6 +66,8 @@ namespace Swift
 
 		vkQueueSubmit(renderer->GetLogicalDevice()->GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
 		vkQueueWaitIdle(renderer->GetLogicalDevice()->GetGraphicsQueue());
+
+		Renderer::GetCurrentRenderData().Submits++;
 	}
 
 	void VulkanCommand::EndAndSubmit()
@@ -92,6 +95,7 @@ namespace Swift
 		if (vmaCreateBuffer(s_Allocator, &bufferInfo, &allocInfo, &dstBuffer, &allocation, nullptr) != VK_SUCCESS)
 			APP_LOG_ERROR("Failed to allocate buffer.");
 
+		Renderer::GetCurrentRenderData().Allocations++;
 		return allocation;
 	}
 
@@ -101,7 +105,10 @@ namespace Swift
 
 		VkBufferCopy copyRegion = {};
 		copyRegion.size = size;
-		vkCmdCopyBuffer(command.GetVulkanCommandBuffer(), srcBuffer, dstBuffer, 1, &copyRegion);
+		{
+			APP_PROFILE_GPU_SCOPE(((VulkanRenderer*)Renderer::GetInstance())->GetProfilerContext(), command.GetVulkanCommandBuffer(), "CopyBuffer");
+			vkCmdCopyBuffer(command.GetVulkanCommandBuffer(), srcBuffer, dstBuffer, 1, &copyRegion);
+		}
 
 		command.EndAndSubmit();
 	}
@@ -137,6 +144,7 @@ namespace Swift
 		if (result != VK_SUCCESS)
 			APP_LOG_ERROR("Failed to create Vulkan image. Code: {0}", VkResultToString(result));
 
+		Renderer::GetCurrentRenderData().Allocations++;
 		return allocation;
 	}
 
@@ -157,7 +165,10 @@ namespace Swift
 		region.imageOffset = { 0, 0, 0 };
 		region.imageExtent = { width, height, 1 };
 
-		vkCmdCopyBufferToImage(command.GetVulkanCommandBuffer(), buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+		{
+			APP_PROFILE_GPU_SCOPE(((VulkanRenderer*)Renderer::GetInstance())->GetProfilerContext(), command.GetVulkanCommandBuffer(), "CopyBufferToImage");
+			vkCmdCopyBufferToImage(command.GetVulkanCommandBuffer(), buffer, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+		}
 
 		command.EndAndSubmit();
 	}
@@ -508,6 +519,7 @@ namespace Swift
 			APP_LOG_ERROR("Unsupported layout transition!");
 
 		vkCmdPipelineBarrier(command.GetVulkanCommandBuffer(), sourceStage, destinationStage, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+		Renderer::GetCurrentRenderData().Barriers++;
 
 		command.EndAndSubmit();
 	}
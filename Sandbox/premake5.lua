@@ -60,6 +60,23 @@ project "Sandbox"
 			"GLFW_INCLUDE_NONE"
 		}
 
+	filter "system:linux"
+		systemversion "latest"
+		staticruntime "on"
+
+		defines
+		{
+			"APP_PLATFORM_LINUX",
+			"GLFW_INCLUDE_NONE"
+		}
+
+		-- Needed by Tracy
+		links
+		{
+			"pthread",
+			"dl"
+		}
+
 	filter "configurations:Debug"
 		defines "APP_DEBUG"
 		runtime "Debug"
@@ -4,6 +4,7 @@
 #include <Swift/Core/Input/Input.hpp>
 
 #include <Swift/Renderer/Shader.hpp>
+#include <Swift/Renderer/Renderer.hpp>
 
 #include <imgui.h>
 
@@ -19,17 +20,15 @@ void SandboxLayer::OnUpdate(float deltaTime)
 {
 	// Note(Jorben): All of this below is just to show some stats in the titlebar
 	static float timer = 0.0f;
-	static uint32_t FPS = 0;
-	static uint32_t tempFPS = 0;
 	timer += deltaTime;
-	tempFPS += 1u;
 
 	if (timer >= 1.0f)
 	{
-		FPS = (uint32_t)((float)tempFPS / timer);
-		Application::Get().GetWindow().SetTitle(fmt::format("SandboxApp | FPS: {0} | Frametime: {1:.3f}ms", FPS, timer / (float)FPS * 1000.0f));
+		auto& statistics = Renderer::GetStatistics();
+		StatisticSummary frameTime = statistics.Summarize([](const FrameSample& sample) { return sample.FrameTime; });
+
+		Application::Get().GetWindow().SetTitle(fmt::format("SandboxApp | FPS: {0:.0f} | Frametime: {1:.3f}ms (p99: {2:.3f}ms)", statistics.GetFPS(), frameTime.Average, frameTime.P99));
 		timer = 0.0f;
-		tempFPS = 0u;
 	}
 }
 
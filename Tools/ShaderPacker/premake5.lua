@@ -0,0 +1,103 @@
+project "ShaderPacker"
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++20"
+	staticruntime "On"
+	
+	architecture "x86_64"
+	
+	targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("%{wks.location}/bin-int/" .. outputdir .. "/%{prj.name}")
+
+	files
+	{
+		"src/**.h",
+		"src/**.hpp",
+		"src/**.cpp"
+	}
+
+	includedirs
+	{
+		"src",
+		"%{wks.location}/vendor",
+
+		"%{wks.location}/Core/src",
+
+		"%{Dependencies.GLFW.IncludeDir}",
+		"%{Dependencies.GLM.IncludeDir}",
+		"%{Dependencies.Spdlog.IncludeDir}",
+		"%{Dependencies.Tracy.IncludeDir}",
+		"%{Dependencies.VMA.IncludeDir}"
+	}
+
+	links
+	{
+		"Swift"
+	}
+
+	disablewarnings
+	{
+		"4005",
+		"4996"
+	}
+
+	-- Note(Jorben): Packs the Sandbox shaders into a single archive every time the tool is built
+	postbuildcommands
+	{
+		"\"%{cfg.buildtarget.abspath}\" \"%{wks.location}/Sandbox/assets/shaders\" \"%{wks.location}/Sandbox/assets/shaders/shaders.swsa\""
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+		staticruntime "on"
+
+		defines
+		{
+			"APP_PLATFORM_WINDOWS",
+			"GLFW_INCLUDE_NONE"
+		}
+
+	filter "system:linux"
+		systemversion "latest"
+		staticruntime "on"
+
+		defines
+		{
+			"APP_PLATFORM_LINUX",
+			"GLFW_INCLUDE_NONE"
+		}
+
+		-- Needed by Tracy
+		links
+		{
+			"pthread",
+			"dl"
+		}
+
+	filter "configurations:Debug"
+		defines "APP_DEBUG"
+		runtime "Debug"
+		symbols "on"
+		editandcontinue "Off"
+
+		defines
+		{
+			"TRACY_ENABLE",
+			"NOMINMAX"
+		}
+
+	filter "configurations:Release"
+		defines "APP_RELEASE"
+		runtime "Release"
+		optimize "on"
+
+		defines
+		{
+			"TRACY_ENABLE",
+			"NOMINMAX"
+		}
+
+	filter "configurations:Dist"
+		defines "APP_DIST"
+		runtime "Release"
+		optimize "Full"
\ No newline at end of file
@@ -0,0 +1,78 @@
+#include <Swift/Core/Logging.hpp>
+
+#include <Swift/Renderer/Shader.hpp>
+#include <Swift/Renderer/ShaderArchive.hpp>
+
+#include <filesystem>
+
+using namespace Swift;
+
+// Note(Jorben): The stage is taken from the second extension, so 'Name.vert.glsl', 'Name.frag.glsl' or 'Name.comp.glsl'
+static ShaderStage GetStage(const std::filesystem::path& path)
+{
+	std::string stage = path.stem().extension().string();
+
+	if (stage == ".vert")
+		return ShaderStage::Vertex;
+	else if (stage == ".frag")
+		return ShaderStage::Fragment;
+	else if (stage == ".comp")
+		return ShaderStage::Compute;
+
+	return ShaderStage::None;
+}
+
+// ----------------------------------------------------------------
+// Usage: ShaderPacker <shader directory> <output archive>
+// Every shader is stored by its filename (e.g. 'Shading.frag.glsl')
+// with the default compile options of the build configuration
+// ----------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+	Log::Init();
+
+	if (argc < 3)
+	{
+		APP_LOG_ERROR("Usage: ShaderPacker <shader directory> <output archive>");
+		return 1;
+	}
+
+	std::filesystem::path directory = argv[1];
+	std::filesystem::path output = argv[2];
+
+	std::vector<ShaderArchiveInput> shaders = { };
+	std::vector<ShaderCompileJob> jobs = { };
+
+	for (auto& file : std::filesystem::directory_iterator(directory))
+	{
+		if (!file.is_regular_file() || file.path().extension() != ".glsl")
+			continue;
+
+		ShaderStage stage = GetStage(file.path());
+		if (stage == ShaderStage::None)
+		{
+			APP_LOG_WARN("Skipping '{0}', unknown shader stage.", file.path().string());
+			continue;
+		}
+
+		shaders.push_back({ file.path().filename().string(), stage, {}, {} });
+		jobs.push_back({ file.path().filename().string(), ShaderCacher::ResolveIncludes(file.path()), stage, {} });
+	}
+
+	auto compiler = ShaderCompiler::Create();
+	auto results = compiler->CompileBatch(jobs, [&](size_t index, const std::vector<char>& code)
+	{
+		APP_LOG_INFO("Compiled '{0}' ({1} bytes)", shaders[index].Name, code.size());
+	});
+
+	for (size_t i = 0; i < shaders.size(); i++)
+		shaders[i].Code = std::move(results[i]);
+
+	compiler->LogReports();
+
+	if (!ShaderArchive::Write(output, shaders))
+		return 1;
+
+	APP_LOG_INFO("Packed {0} shader(s) into '{1}'", shaders.size(), output.string());
+	return 0;
+}
\ No newline at end of file
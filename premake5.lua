@@ -91,6 +91,18 @@ Dependencies =
 }
 ------------------------------------------------------------------------------
 
+------------------------------------------------------------------------------
+-- Options
+------------------------------------------------------------------------------
+-- Note(Jorben): Builds with the null renderer (APP_RENDERER_NULL) and without Vulkan, VMA & shaderc,
+-- so the engine can be built & run on (CI) machines that don't have the Vulkan SDK or a GPU.
+newoption
+{
+	trigger = "null-renderer",
+	description = "Build with the null renderer, without Vulkan"
+}
+------------------------------------------------------------------------------
+
 ------------------------------------------------------------------------------
 -- Solution
 ------------------------------------------------------------------------------
@@ -112,15 +124,30 @@ workspace "Swift"
 		"MultiProcessorCompile"
 	}
 
+	filter "options:null-renderer"
+		defines "APP_RENDERER_NULL"
+
+	filter {}
+
 group "Dependencies"
 	include "vendor/glfw"
 	include "vendor/tracy"
-	include "vendor/vma"
+
+	if not _OPTIONS["null-renderer"] then
+		include "vendor/vma"
+	end
 group ""
 
 group "Swift"
 	include "Core"
 group ""
 
+-- Note(Jorben): The ShaderPacker compiles shaders through shaderc
+if not _OPTIONS["null-renderer"] then
+	group "Tools"
+		include "Tools/ShaderPacker"
+	group ""
+end
+
 include "Sandbox"
 ------------------------------------------------------------------------------
\ No newline at end of file
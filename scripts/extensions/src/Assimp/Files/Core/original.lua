@@ -34,6 +34,10 @@ project "Swift"
 		"src/Swift/Vulkan/**.hpp",
 		"src/Swift/Vulkan/**.cpp",
 
+		"src/Swift/Null/**.h",
+		"src/Swift/Null/**.hpp",
+		"src/Swift/Null/**.cpp",
+
 		"src/Swift/Platforms/" .. FirstToUpper("%{cfg.system}") .. "/**.h",
 		"src/Swift/Platforms/" .. FirstToUpper("%{cfg.system}") .. "/**.hpp",
 		"src/Swift/Platforms/" .. FirstToUpper("%{cfg.system}") .. "/**.cpp",
@@ -65,7 +69,7 @@ project "Swift"
 	links
 	{
 		"%{Dependencies.GLFW.LibName}",
-		"%{Dependencies.VMA.LibName}"
+		"%{Dependencies.Tracy.LibName}"
 	}
 
 	disablewarnings
@@ -83,6 +87,7 @@ project "Swift"
 			"APP_PLATFORM_WINDOWS"
 		}
 
+	filter { "system:windows", "options:not null-renderer" }
 		includedirs
 		{
 			"%{Dependencies.Vulkan.Windows.IncludeDir}"
@@ -90,7 +95,6 @@ project "Swift"
 
 		links
 		{
-			"%{Dependencies.Tracy.LibName}",
 			"%{Dependencies.Vulkan.Windows.LibDir}" .. "%{Dependencies.ShaderC.LibName}",
 			"%{Dependencies.Vulkan.Windows.LibDir}" .. "%{Dependencies.Vulkan.Windows.LibName}"
 		}
@@ -104,6 +108,7 @@ project "Swift"
 			"APP_PLATFORM_LINUX"
 		}
 
+	filter { "system:linux", "options:not null-renderer" }
 		includedirs
 		{
 			"%{Dependencies.Vulkan.Linux.IncludeDir}"
@@ -115,6 +120,19 @@ project "Swift"
 			"%{Dependencies.Vulkan.Linux.LibDir}" .. "%{Dependencies.ShaderC.LibName}"
 		}
 
+	filter "options:not null-renderer"
+		links
+		{
+			"%{Dependencies.VMA.LibName}"
+		}
+
+	-- Note(Jorben): APP_RENDERER_NULL itself gets defined for every project, see premake5.lua
+	filter "options:null-renderer"
+		removefiles
+		{
+			"src/Swift/Vulkan/**"
+		}
+
 	filter "configurations:Debug"
 		defines "APP_DEBUG"
 		runtime "Debug"
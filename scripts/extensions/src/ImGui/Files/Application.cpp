@@ -4,9 +4,11 @@
 #include <GLFW/glfw3.h>
 
 #include "Swift/Core/Logging.hpp"
+#include "Swift/Core/HeadlessWindow.hpp"
 #include "Swift/Core/Input/Input.hpp"
 
 #include "Swift/Renderer/Renderer.hpp"
+#include "Swift/Renderer/RenderThread.hpp"
 
 #include "Swift/Utils/Profiler.hpp"
 #include "Swift/Utils/BaseImGuiLayer.hpp"
@@ -21,22 +23,32 @@ namespace Swift
 	{
 		s_Instance = this;
 	
-		Input::Init();
+		Input::Init(appInfo.Headless);
 		Log::Init();
 
-		m_Window = Window::Create(appInfo.WindowSpecs);
+		if (appInfo.Headless)
+			m_Window = std::make_unique<HeadlessWindow>(appInfo.WindowSpecs);
+		else
+			m_Window = Window::Create(appInfo.WindowSpecs);
 		m_Window->SetEventCallBack(APP_BIND_EVENT_FN(Application::OnEvent));
 
 		Renderer::Init();
 
 		m_ImGuiLayer = BaseImGuiLayer::Create();
         m_LayerStack.AddOverlay((Layer*)m_ImGuiLayer);
+
+		// Note(Jorben): ImGui & GLFW have to be used from the main thread, but in pipelined mode the UI queue would be executed
+		// by the render thread (while GLFW's input callbacks write to ImGuiIO on the main thread). So the ImGui extension always runs serial, see RenderThread.hpp
+		APP_ASSERT((appInfo.Threading != ThreadingMode::Pipelined), "ThreadingMode::Pipelined can't be combined with the ImGui extension, falling back to ThreadingMode::Serial.");
+
+		m_Scheduler = std::make_unique<FrameScheduler>(appInfo.SchedulerSpecs);
 	}
 
 	Application::~Application()
 	{
 		Input::Destroy();
 
+		RenderThread::Destroy();
 		Renderer::Wait();
 
 		for (Layer* layer : m_LayerStack)
@@ -51,6 +63,8 @@ namespace Swift
 
 	void Application::OnEvent(Event& e)
 	{
+		m_FrameRequested = true;
+
 		EventHandler handler(e);
 
 		handler.Handle<WindowCloseEvent>(APP_BIND_EVENT_FN(Application::OnWindowClose));
@@ -66,21 +80,49 @@ namespace Swift
 
 	void Application::Run()
 	{
+		APP_PROFILE_THREAD("Main Thread");
+
 		while (m_Running)
 		{
-			// Delta Time
-			float currentTime = (float)Utils::ToolKit::GetTime();
-			static float lastTime = 0.0f;
+			if (!WaitForWork())
+				continue;
 
-			float deltaTime = currentTime - lastTime;
-			lastTime = currentTime;
+			// Delta Time
+			float deltaTime = m_Scheduler->BeginFrame();
 
 			// Update & Render
 			m_Window->OnUpdate();
+			uint64_t layerStart = Utils::ToolKit::GetTimeNanoseconds();
+			{
+				APP_PROFILE_SCOPE("FixedUpdate");
+				while (m_Scheduler->FixedStep())
+				{
+					for (Layer* layer : m_LayerStack)
+						layer->OnFixedUpdate(m_Scheduler->GetFixedDeltaTime());
+				}
+			}
+			uint64_t layerTime = Utils::ToolKit::GetTimeNanoseconds() - layerStart;
+			if (!RenderThread::Enabled())
 			{
 				APP_PROFILE_SCOPE("Renderer::Begin");
 				Renderer::BeginFrame();
 			}
+			layerStart = Utils::ToolKit::GetTimeNanoseconds();
+			if (m_LayerStack.HasParallelLayers())
+			{
+				// Note(Jorben): Rendering keeps the stack order, so it only starts once every layer is updated
+				{
+					APP_PROFILE_SCOPE("Update");
+					m_LayerStack.Update(deltaTime);
+				}
+				if (!m_Minimized)
+				{
+					APP_PROFILE_SCOPE("Render");
+					for (Layer* layer : m_LayerStack)
+						layer->OnRender();
+				}
+			}
+			else
 			{
 				APP_PROFILE_SCOPE("Update & Render");
 				for (Layer* layer : m_LayerStack)
@@ -99,12 +141,55 @@ namespace Swift
                     layer->OnImGuiRender();
             }
 
+			layerTime += Utils::ToolKit::GetTimeNanoseconds() - layerStart;
+			Renderer::GetStatistics().SetLayerTime((float)layerTime / 1000000.0f);
+
+			if (RenderThread::Enabled())
+			{
+				RenderThread::Kick();
+				m_Window->OnRender();
+			}
+			else
 			{
 				APP_PROFILE_SCOPE("Renderer::End");
 				Renderer::EndFrame();
 				m_Window->OnRender();
 			}
+
+			m_Scheduler->EndFrame();
+		}
+	}
+
+	void Application::RequestFrame()
+	{
+		m_FrameRequested = true;
+		m_Window->Wake();
+	}
+
+	bool Application::WaitForWork()
+	{
+		const IdleSpecification& idle = m_AppInfo.IdleSpecs;
+
+		// Note(Jorben): Layers still get updated while idle, just a lot less often
+		if (m_Minimized && idle.MinimizedTimeout > 0.0f)
+			m_Window->WaitEvents(idle.MinimizedTimeout);
+		else if (idle.UnfocusedTimeout > 0.0f && !m_Window->IsFocused())
+			m_Window->WaitEvents(idle.UnfocusedTimeout);
+
+		if (!idle.RenderOnDemand)
+			return true;
+
+		// Note(Jorben): Events (through OnEvent) and RequestFrame() set the flag while waiting
+		if (!m_FrameRequested.exchange(false))
+		{
+			m_Window->WaitEvents(idle.OnDemandTimeout);
+
+			// Note(Jorben): Without this the first frame after waking up gets a delta time that covers the whole idle period
+			m_Scheduler->Resume();
+			return m_FrameRequested.exchange(false);
 		}
+
+		return true;
 	}
 
 	void Application::AddLayer(Layer* layer)
@@ -125,6 +210,9 @@ namespace Swift
 
 	bool Application::OnWindowResize(WindowResizeEvent& e)
 	{
+		// Note(Jorben): The render thread reads the minimized state and uses the swapchain, so it has to be idle
+		RenderThread::Wait();
+
 		if (e.GetWidth() == 0 || e.GetHeight() == 0)
 		{
 			m_Minimized = true;
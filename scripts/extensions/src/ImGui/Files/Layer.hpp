@@ -1,13 +1,31 @@
 #pragma once
 
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "Swift/Core/Events.hpp"
 
+#include "Swift/Utils/ThreadPool.hpp"
+
 namespace Swift
 {
 
+	// Note(Jorben): Layers are updated strictly in order, unless they opt in with Parallel.
+	// Parallel layers only keep their order relative to layers they share a resource with (one of them writing it),
+	// a non parallel layer still waits for everything before it and everything after it waits for it.
+	struct LayerDependencies
+	{
+	public:
+		bool Parallel = false;
+
+		std::vector<std::string> Reads = { };
+		std::vector<std::string> Writes = { };
+
+	public:
+		bool ConflictsWith(const LayerDependencies& other) const;
+	};
+
 	class Layer
 	{
 	public:
@@ -18,14 +36,21 @@ namespace Swift
 		virtual void OnDetach() {}
 
 		virtual void OnUpdate(float deltaTime) {}
+		virtual void OnFixedUpdate(float fixedDeltaTime) {} // Note(Jorben): Only called when ApplicationSpecification::SchedulerSpecs.UpdateRate is set
 		virtual void OnRender() {}
 		virtual void OnEvent(Event& e) {}
         virtual void OnImGuiRender() {}
 
 		inline const std::string& GetName() { return m_DebugName; }
+		inline const LayerDependencies& GetDependencies() const { return m_Dependencies; }
+
+	protected:
+		// Note(Jorben): Requests a new frame, only needed when ApplicationSpecification::IdleSpecs.RenderOnDemand is set.
+		void MarkDirty();
 
 	protected:
 		std::string m_DebugName;
+		LayerDependencies m_Dependencies = {}; // Note(Jorben): Should be set before the layer gets added to the stack
 	};
 
 }
@@ -44,6 +69,10 @@ namespace Swift
 		void AddOverlay(Layer* overlay);
 		void PopOverlay(Layer* overlay);
 
+		// Note(Jorben): Calls OnUpdate on every layer, layers in the same level of the update graph run in parallel.
+		void Update(float deltaTime);
+		bool HasParallelLayers();
+
 		std::vector<Layer*>::iterator				begin()				{ return m_Layers.begin(); }
 		std::vector<Layer*>::iterator				end()				{ return m_Layers.end(); }
 		std::vector<Layer*>::const_iterator			begin()		const { return m_Layers.begin(); }
@@ -54,9 +83,19 @@ namespace Swift
 		std::vector<Layer*>::const_reverse_iterator rbegin()	const { return m_Layers.rbegin(); }
 		std::vector<Layer*>::const_reverse_iterator rend()		const { return m_Layers.rend(); }
 
+	private:
+		void BuildUpdateGraph();
+
 	private:
 		std::vector<Layer*> m_Layers;
 		uint32_t m_InsertIndex;
+
+		// Note(Jorben): Every level only depends on the levels before it, rebuilt when the stack changes
+		std::vector<std::vector<Layer*>> m_UpdateLevels = { };
+		bool m_HasParallelLayers = false;
+		bool m_GraphDirty = true;
+
+		std::unique_ptr<Utils::ThreadPool> m_Workers = nullptr; // Note(Jorben): Only created when a level has more than one layer
 	};
 
 }
\ No newline at end of file
@@ -4,19 +4,44 @@
 #include "Swift/Core/Layer.hpp"
 
 #include "Swift/Core/Window.hpp"
+#include "Swift/Core/FrameScheduler.hpp"
 
 #include <vector>
 #include <memory>
+#include <atomic>
 #include <queue>
 #include <filesystem>
 
 namespace Swift
 {
 
+	enum class ThreadingMode : uint8_t
+	{
+		Serial = 0, Pipelined // Note(Jorben): Pipelined renders frame N on a render thread while frame N + 1 gets updated, see RenderThread.hpp
+	};
+
+	// Note(Jorben): Timeouts are in seconds, 0 disables waiting for that case.
+	struct IdleSpecification
+	{
+	public:
+		float MinimizedTimeout = 0.1f;
+		float UnfocusedTimeout = 0.0f;
+
+		// Note(Jorben): Only produces a frame after an event or when a layer called MarkDirty()
+		bool RenderOnDemand = false;
+		float OnDemandTimeout = 1.0f; // Note(Jorben): Upper bound for a single wait, it doesn't produce a frame by itself
+	};
+
 	struct ApplicationSpecification
 	{
 	public:
 		WindowSpecification WindowSpecs = { };
+		FrameSchedulerSpecification SchedulerSpecs = { };
+		IdleSpecification IdleSpecs = { };
+		ThreadingMode Threading = ThreadingMode::Serial;
+
+		// Note(Jorben): Renders to offscreen images without a window, surface or present. Frames are only paced by fences.
+		bool Headless = false;
 
 	public:
 		ApplicationSpecification() = default;
@@ -37,12 +62,19 @@ namespace Swift
 		void AddOverlay(Layer* layer);
 
 		inline Window& GetWindow() { return *m_Window; }
+		inline const ApplicationSpecification& GetSpecification() const { return m_AppInfo; }
+		inline FrameScheduler& GetScheduler() { return *m_Scheduler; }
 
 		inline static Application& Get() { return *s_Instance; }
 
 		inline bool IsMinimized() const { return m_Minimized; }
+		// Note(Jorben): Makes sure another frame gets produced when rendering on demand, can be called from any thread.
+		void RequestFrame();
+		inline bool IsHeadless() const { return m_AppInfo.Headless; }
 
 	private:
+		bool WaitForWork(); // Note(Jorben): Returns false if there is no reason to produce a frame
+
 		bool OnWindowClose(WindowCloseEvent& e);
 		bool OnWindowResize(WindowResizeEvent& e);
 
@@ -50,8 +82,10 @@ namespace Swift
 		ApplicationSpecification m_AppInfo = {};
 
 		std::unique_ptr<Window> m_Window = nullptr;
+		std::unique_ptr<FrameScheduler> m_Scheduler = nullptr;
 		bool m_Running = true;
 		bool m_Minimized = false;
+		std::atomic<bool> m_FrameRequested = true;
 
 		LayerStack m_LayerStack = {};
 
@@ -7,11 +7,13 @@
 #include "Swift/Utils/Utils.hpp"
 
 #include "Swift/Renderer/RendererConfig.hpp"
+#include "Swift/Renderer/FrameStatistics.hpp"
 
 namespace Swift
 {
 
 	class CommandBuffer;
+	class Pipeline;
 	class RenderInstance;
 	class IndexBuffer;
 	class Image2D;
@@ -31,8 +33,10 @@ namespace Swift
 
 		static void Wait();
 
-		static void Draw(Ref<CommandBuffer> commandBuffer, uint32_t verticeCount = 3);
-		static void DrawIndexed(Ref<CommandBuffer> commandBuffer, Ref<IndexBuffer> indexBuffer);
+		static void Draw(const Ref<CommandBuffer>& commandBuffer, uint32_t verticeCount = 3);
+		static void DrawIndexed(const Ref<CommandBuffer>& commandBuffer, const Ref<IndexBuffer>& indexBuffer);
+		// Note(Jorben): Records all commands in one go, the pipeline (and any shared descriptor sets) should already be bound.
+		static void DrawBatch(const Ref<CommandBuffer>& commandBuffer, const Ref<Pipeline>& pipeline, std::span<const DrawCommand> commands);
 
 		static void OnResize(uint32_t width, uint32_t height);
 
@@ -43,13 +47,24 @@ namespace Swift
 		static std::vector<Ref<Image2D>>& GetSwapChainImages();
 		static Ref<Image2D> GetDepthImage();
 
-		inline static RenderData& GetRenderData() { return s_Data; }
+		// Note(Jorben): The data of the last finished frame, safe to read from the main thread (also in pipelined mode).
+		inline static const RenderData& GetRenderData() { return s_Snapshot; }
+		// Note(Jorben): The data of the frame that is currently being recorded, only the backend should use this.
+		inline static RenderData& GetCurrentRenderData() { return s_Data; }
+		inline static FrameStatistics& GetStatistics() { return s_Statistics; }
 
 		static RenderInstance* GetInstance();
+
+	private:
+		static void UpdateSnapshot();
 		
 	private:
 		static RendererSpecification s_Specification;
 		static RenderData s_Data;
+		static RenderData s_Snapshot;
+		static FrameStatistics s_Statistics;
+
+		friend class RenderThread;
 	};
 
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "Swift/Renderer/RenderInstance.hpp"
 
 #include "Swift/Vulkan/VulkanDevice.hpp"
+#include "Swift/Vulkan/VulkanProfiler.hpp"
 #include "Swift/Vulkan/VulkanPhysicalDevice.hpp"
 #include "Swift/Vulkan/VulkanSwapChain.hpp"
 
@@ -26,7 +27,7 @@ namespace Swift
 	static const std::vector<const char*> s_RequestedValidationLayers = { "VK_LAYER_KHRONOS_validation" };
 	static const std::vector<const char*> s_RequestedDeviceExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
 
-	class VulkanRenderer : public RenderInstance
+	class VulkanRenderer final : public RenderInstance
 	{
 	public:
 		VulkanRenderer();
@@ -42,8 +43,9 @@ namespace Swift
 
 		void Wait() override;
 
-		void Draw(Ref<CommandBuffer> commandBuffer, uint32_t verticeCount) override;
-		void DrawIndexed(Ref<CommandBuffer> commandBuffer, Ref<IndexBuffer> indexBuffer) override;
+		void Draw(const Ref<CommandBuffer>& commandBuffer, uint32_t verticeCount) override;
+		void DrawIndexed(const Ref<CommandBuffer>& commandBuffer, const Ref<IndexBuffer>& indexBuffer) override;
+		void DrawBatch(const Ref<CommandBuffer>& commandBuffer, const Ref<Pipeline>& pipeline, std::span<const DrawCommand> commands) override;
 
 		void OnResize(uint32_t width, uint32_t height) override;
 
@@ -62,6 +64,9 @@ namespace Swift
 		inline Ref<VulkanPhysicalDevice> GetPhysicalDevice() { return m_PhysicalDevice; }
 		inline Ref<VulkanSwapChain> GetSwapChain() { return m_SwapChain; }
 
+		// Note(Jorben): One context for the graphics queue, since Tracy only allows 255 GPU contexts per process. Can be nullptr.
+		inline VulkanProfilerContext GetProfilerContext() { return m_ProfilerContext; }
+
 	private:
 		VkInstance m_VulkanInstance = VK_NULL_HANDLE;
 		VkDebugUtilsMessengerEXT m_DebugMessenger = VK_NULL_HANDLE;
@@ -71,6 +76,8 @@ namespace Swift
 		Ref<VulkanDevice> m_Device = VK_NULL_HANDLE;
 		Ref<VulkanSwapChain> m_SwapChain = VK_NULL_HANDLE;
 
+		VulkanProfilerContext m_ProfilerContext = nullptr;
+
 	private:
 		Utils::Queue<RenderFunction> m_RenderQueue = { };
 		Utils::Queue<FreeFunction> m_ResourceFreeQueue = { };
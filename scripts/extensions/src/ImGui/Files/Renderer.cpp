@@ -3,10 +3,8 @@
 
 #include "Swift/Core/Logging.hpp"
 
-#include "Swift/Renderer/RenderInstance.hpp"
-
-#include "Swift/Renderer/Buffers.hpp"
-#include "Swift/Renderer/CommandBuffer.hpp"
+#include "Swift/Renderer/Backend.hpp"
+#include "Swift/Renderer/RenderThread.hpp"
 
 namespace Swift
 {
@@ -14,6 +12,18 @@ namespace Swift
 	static RenderInstance* s_RenderInstance = nullptr;
 	RendererSpecification Renderer::s_Specification = {};
 	RenderData Renderer::s_Data = {};
+	RenderData Renderer::s_Snapshot = {};
+	FrameStatistics Renderer::s_Statistics = {};
+
+	// Note(Jorben): Only touched by the thread that begins & ends frames
+	static float s_BeginFrameTime = 0.0f;
+	static uint64_t s_LastFrameEnd = 0;
+
+	// Note(Jorben): The instance is always created by RenderInstance::Create() for the compiled in API, so this cast is safe.
+	static inline Backend::RenderInstanceType* GetBackend()
+	{
+		return static_cast<Backend::RenderInstanceType*>(s_RenderInstance);
+	}
 
 	void Renderer::Init()
 	{
@@ -33,72 +43,130 @@ namespace Swift
 
 	void Renderer::BeginFrame()
 	{
-		s_RenderInstance->BeginFrame();
+		uint64_t start = Utils::ToolKit::GetTimeNanoseconds();
+		GetBackend()->BeginFrame();
+		s_BeginFrameTime = (float)(Utils::ToolKit::GetTimeNanoseconds() - start) / 1000000.0f;
 	}
 
 	void Renderer::EndFrame()
 	{
-		s_RenderInstance->EndFrame();
+		uint64_t start = Utils::ToolKit::GetTimeNanoseconds();
+		GetBackend()->EndFrame();
+		uint64_t end = Utils::ToolKit::GetTimeNanoseconds();
+
+		// Note(Jorben): The first frame has nothing to measure its frame time against, so it's left out of the statistics
+		if (s_LastFrameEnd)
+		{
+			FrameSample sample = {};
+			sample.FrameTime = (float)(end - s_LastFrameEnd) / 1000000.0f;
+			sample.BeginFrameTime = s_BeginFrameTime;
+			sample.LayerTime = s_Statistics.GetLayerTime();
+			sample.EndFrameTime = (float)(end - start) / 1000000.0f;
+
+			sample.DrawCalls = s_Data.DrawCalls;
+			sample.Triangles = s_Data.Triangles;
+			sample.Instances = s_Data.Instances;
+			sample.Binds = s_Data.Binds;
+			sample.ElidedBinds = s_Data.ElidedBinds;
+			sample.Submits = s_Data.Submits;
+			sample.Barriers = s_Data.Barriers;
+			sample.DescriptorWrites = s_Data.DescriptorWrites;
+			sample.Allocations = s_Data.Allocations;
+			sample.UploadedBytes = s_Data.UploadedBytes;
+
+			s_Statistics.Push(sample);
+		}
+
+		s_LastFrameEnd = end;
+
+		// Note(Jorben): In pipelined mode this happens on the main thread at the hand-off (RenderThread::Kick), since the render thread is idle then.
+		if (!RenderThread::Enabled())
+			UpdateSnapshot();
+	}
+
+	void Renderer::UpdateSnapshot()
+	{
+		s_Snapshot = s_Data;
 	}
 
 	void Renderer::Submit(RenderFunction function)
 	{
-		s_RenderInstance->Submit(function);
+		// Note(Jorben): In pipelined mode everything submitted outside of the render thread is part of the next frame
+		if (RenderThread::Enabled() && !RenderThread::IsRenderThread())
+		{
+			RenderThread::Submit(function);
+			return;
+		}
+
+		GetBackend()->Submit(function);
 	}
 
 	void Renderer::SubmitFree(FreeFunction function)
 	{
-		s_RenderInstance->SubmitFree(function);
+		GetBackend()->SubmitFree(function);
 	}
 
 	void Renderer::SubmitUI(UIFunction function)
 	{
-		s_RenderInstance->SubmitUI(function);
+		// Note(Jorben): The UI queue gets executed by the render thread, so the function is handed to it with the rest of the frame
+		if (RenderThread::Enabled() && !RenderThread::IsRenderThread())
+		{
+			RenderThread::Submit([function]() { GetBackend()->SubmitUI(function); });
+			return;
+		}
+
+		GetBackend()->SubmitUI(function);
 	}
 
 	void Renderer::Wait()
 	{
-		s_RenderInstance->Wait();
+		GetBackend()->Wait();
+	}
+
+	void Renderer::Draw(const Ref<CommandBuffer>& commandBuffer, uint32_t verticeCount)
+	{
+		GetBackend()->Draw(commandBuffer, verticeCount);
 	}
 
-	void Renderer::Draw(Ref<CommandBuffer> commandBuffer, uint32_t verticeCount)
+	void Renderer::DrawIndexed(const Ref<CommandBuffer>& commandBuffer, const Ref<IndexBuffer>& indexBuffer)
 	{
-		s_RenderInstance->Draw(commandBuffer, verticeCount);
+		GetBackend()->DrawIndexed(commandBuffer, indexBuffer);
 	}
 
-	void Renderer::DrawIndexed(Ref<CommandBuffer> commandBuffer, Ref<IndexBuffer> indexBuffer)
+	void Renderer::DrawBatch(const Ref<CommandBuffer>& commandBuffer, const Ref<Pipeline>& pipeline, std::span<const DrawCommand> commands)
 	{
-		s_RenderInstance->DrawIndexed(commandBuffer, indexBuffer);
+		GetBackend()->DrawBatch(commandBuffer, pipeline, commands);
 	}
 
 	void Renderer::OnResize(uint32_t width, uint32_t height)
 	{
-		s_RenderInstance->OnResize(width, height);
+		RenderThread::Wait();
+		GetBackend()->OnResize(width, height);
 	}
 
 	Utils::Queue<RenderFunction>& Renderer::GetRenderQueue()
 	{
-		return s_RenderInstance->GetRenderQueue();
+		return GetBackend()->GetRenderQueue();
 	}
 
 	Utils::Queue<FreeFunction>& Renderer::GetFreeQueue()
 	{
-		return s_RenderInstance->GetFreeQueue();
+		return GetBackend()->GetFreeQueue();
 	}
 
 	uint32_t Renderer::GetCurrentFrame()
 	{
-		return s_RenderInstance->GetCurrentFrame();;
+		return GetBackend()->GetCurrentFrame();
 	}
 
 	std::vector<Ref<Image2D>>& Renderer::GetSwapChainImages()
 	{
-		return s_RenderInstance->GetSwapChainImages();
+		return GetBackend()->GetSwapChainImages();
 	}
 
 	Ref<Image2D> Renderer::GetDepthImage()
 	{
-		return s_RenderInstance->GetDepthImage();
+		return GetBackend()->GetDepthImage();
 	}
 
 	RenderInstance* Renderer::GetInstance()
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <span>
+#include <atomic>
+#include <string>
+#include <vector>
 #include <functional>
 
 #include "Swift/Core/Core.hpp"
@@ -7,6 +11,10 @@
 namespace Swift
 {
 
+	class VertexBuffer;
+	class IndexBuffer;
+	class DescriptorSet;
+
 	typedef std::function<void()> RenderFunction;
 	typedef std::function<void()> FreeFunction;
 	typedef std::function<void()> UIFunction;
@@ -23,19 +31,95 @@ namespace Swift
 			None = 0, Single = 1, Double = 2, Triple = 3
 		};
 	public:
+		// Note(Jorben): Define APP_RENDERER_NULL (premake5 --null-renderer) to build with the null renderer, which records what it's asked to do without using a GPU.
+		#if defined(APP_RENDERER_NULL)
+		inline static constexpr const RenderingAPI API = RenderingAPI::None;
+		#else
 		inline static constexpr const RenderingAPI API = RenderingAPI::Vulkan;
+		#endif
 		inline static constexpr const BufferMode BufferCount = BufferMode::Triple;
 	};
 
+	// Note(Jorben): Plain data on purpose, the pointers are non-owning so the caller has to keep the resources alive until the batch is recorded.
+	struct DrawCommand
+	{
+	public:
+		VertexBuffer* Vertexbuffer = nullptr;
+		IndexBuffer* Indexbuffer = nullptr; // Note(Jorben): When nullptr the draw is not indexed
+
+		uint32_t Count = 0; // Note(Jorben): Index count or vertex count (when not indexed)
+		uint32_t InstanceCount = 1;
+		uint32_t First = 0; // Note(Jorben): First index or first vertex (when not indexed)
+		int32_t VertexOffset = 0;
+
+		DescriptorSet* Set = nullptr; // Note(Jorben): Optional per draw set, bound with the dynamic offset if DynamicOffsetCount is 1
+		uint32_t DynamicOffset = 0;
+		uint32_t DynamicOffsetCount = 0; // Note(Jorben): 0 or 1
+	};
+
+	struct GPUTiming
+	{
+	public:
+		const char* Name = nullptr; // Note(Jorben): Interned by the backend, stays valid for the lifetime of the application
+		float Duration = 0.0f; // Note(Jorben): In milliseconds
+	};
+
 	struct RenderData
 	{
 	public:
-		uint32_t DrawCalls = 0;
+		// Note(Jorben): Every counter is atomic, since they also get updated from outside of the render thread
+		// (uploads, resource creation & layers that update in parallel).
+		std::atomic<uint32_t> DrawCalls = 0;
+		std::atomic<uint32_t> Triangles = 0; // Note(Jorben): Assumes triangle lists, so it's the vertex or index count divided by 3 (times the instances)
+		std::atomic<uint32_t> Instances = 0;
+
+		std::atomic<uint32_t> Binds = 0; // Note(Jorben): Pipeline, descriptor set, vertex/index buffer, viewport & scissor commands that were recorded
+		std::atomic<uint32_t> ElidedBinds = 0; // Note(Jorben): Binds that were skipped since the state was already bound
+
+		std::atomic<uint32_t> Submits = 0; // Queue submissions, including single time commands
+		std::atomic<uint32_t> Barriers = 0;
+		std::atomic<uint32_t> DescriptorWrites = 0;
+		std::atomic<uint32_t> Allocations = 0;
+		std::atomic<uint64_t> UploadedBytes = 0;
+
+		// Note(Jorben): Named GPU durations of renderpasses & CommandBuffer timers. They get read back without waiting
+		// on the GPU, so they are from the last time the current frame in flight was used (BufferCount frames ago).
+		std::vector<GPUTiming> GPUTimings = { };
 
 	public:
+		RenderData() = default;
+		RenderData(const RenderData& other) { *this = other; }
+
+		// Note(Jorben): Used to take a snapshot of a finished frame, see Renderer::GetRenderData()
+		inline RenderData& operator = (const RenderData& other)
+		{
+			DrawCalls = other.DrawCalls.load();
+			Triangles = other.Triangles.load();
+			Instances = other.Instances.load();
+			Binds = other.Binds.load();
+			ElidedBinds = other.ElidedBinds.load();
+			Submits = other.Submits.load();
+			Barriers = other.Barriers.load();
+			DescriptorWrites = other.DescriptorWrites.load();
+			Allocations = other.Allocations.load();
+			UploadedBytes = other.UploadedBytes.load();
+			GPUTimings = other.GPUTimings;
+			return *this;
+		}
+
 		inline void Reset()
 		{
 			DrawCalls = 0;
+			Triangles = 0;
+			Instances = 0;
+			Binds = 0;
+			ElidedBinds = 0;
+			Submits = 0;
+			Barriers = 0;
+			DescriptorWrites = 0;
+			Allocations = 0;
+			UploadedBytes = 0;
+			GPUTimings.clear();
 		}
 	};
 
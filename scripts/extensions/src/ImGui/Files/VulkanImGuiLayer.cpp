@@ -100,6 +100,7 @@ namespace Swift
 		specs.ColourAttachment = Renderer::GetSwapChainImages();
 		specs.ColourLoadOp = LoadOperation::Load; 	// To not overwrite previous colour attachments
 		specs.PreviousColourImageLayout = ImageLayout::Presentation; // Because before this pass there is pretty much always a renderpass with Presentation
+		specs.Name = "ImGui";
 
 		m_Renderpass = RefHelper::Create<VulkanRenderPass>(specs, CommandBuffer::Create({}));
 		
@@ -152,7 +153,9 @@ namespace Swift
 		io.DisplaySize = ImVec2((float)Application::Get().GetWindow().GetWidth(), (float)Application::Get().GetWindow().GetHeight());
 
 		ImGui::Render();
-		ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), RefHelper::RefAs<VulkanCommandBuffer>(m_Renderpass->GetCommandBuffer())->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()));
+		auto cmdBuf = RefHelper::RefAs<VulkanCommandBuffer>(m_Renderpass->GetCommandBuffer());
+		ImGui_ImplVulkan_RenderDrawData(ImGui::GetDrawData(), cmdBuf->GetVulkanCommandBuffer(Renderer::GetCurrentFrame()));
+		cmdBuf->InvalidateState(); // Note(Jorben): ImGui binds its own pipeline, buffers, viewport & scissor
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 		{
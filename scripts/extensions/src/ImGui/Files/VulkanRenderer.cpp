@@ -9,6 +9,8 @@
 #include "Swift/Vulkan/VulkanUtils.hpp"
 #include "Swift/Vulkan/VulkanBuffers.hpp"
 #include "Swift/Vulkan/VulkanRenderer.hpp"
+#include "Swift/Vulkan/VulkanPipeline.hpp"
+#include "Swift/Vulkan/VulkanDescriptors.hpp"
 #include "Swift/Vulkan/VulkanTaskManager.hpp"
 #include "Swift/Vulkan/VulkanCommandBuffer.hpp"
 
@@ -64,6 +66,8 @@ namespace Swift
 		m_SwapChain->GetSwapChainImages().clear(); // TODO: Find a better way to do this
 		m_SwapChain->GetDepthImage().reset(); // TODO: Find a better way to do this
 		m_ResourceFreeQueue.Execute();
+
+		APP_PROFILE_GPU_DESTROY(m_ProfilerContext);
 		
 		m_SwapChain.reset();
 		VulkanAllocator::Destroy(); 
@@ -90,13 +94,24 @@ namespace Swift
 		appInfo.engineVersion = VK_MAKE_VERSION(1, 2, 0);
 		appInfo.apiVersion = VK_API_VERSION_1_2;
 
-		#if defined(APP_PLATFORM_WINDOWS)
-			#define VK_KHR_WIN32_SURFACE_EXTENSION_NAME "VK_KHR_win32_surface"
-		#elif defined(APP_PLATFORM_LINUX)
-			#define VK_KHR_WIN32_SURFACE_EXTENSION_NAME "VK_KHR_xcb_surface"
-		#endif
+		const bool headless = Application::Get().IsHeadless();
+
+		std::vector<const char*> instanceExtensions = { };
+		if (headless)
+		{
+			// Note(Jorben): VK_KHR_surface is still enabled, since VK_KHR_swapchain (and with it the presentation layout our renderpasses use) depends on it
+			instanceExtensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+		}
+		else
+		{
+			// Note(Jorben): GLFW knows which surface extensions the platform needs (win32, xcb, xlib or wayland)
+			uint32_t glfwExtensionCount = 0;
+			const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+			if (!glfwExtensions)
+				APP_LOG_FATAL("Vulkan is not supported by the window system.");
 
-		std::vector<const char*> instanceExtensions = { VK_KHR_SURFACE_EXTENSION_NAME, VK_KHR_WIN32_SURFACE_EXTENSION_NAME };
+			instanceExtensions.assign(glfwExtensions, glfwExtensions + glfwExtensionCount);
+		}
 		if constexpr (s_Validation)
 		{
 			instanceExtensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME); // Very little performance hit, can be used in Release.
@@ -158,9 +173,12 @@ namespace Swift
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		// Surface Creation
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-		GLFWwindow* handle = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
-		if (glfwCreateWindowSurface(m_VulkanInstance, handle, nullptr, &m_Surface) != VK_SUCCESS)
-			APP_LOG_ERROR("Failed to create window surface!");
+		if (!headless)
+		{
+			GLFWwindow* handle = static_cast<GLFWwindow*>(Application::Get().GetWindow().GetNativeWindow());
+			if (glfwCreateWindowSurface(m_VulkanInstance, handle, nullptr, &m_Surface) != VK_SUCCESS)
+				APP_LOG_ERROR("Failed to create window surface!");
+		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		// Other
@@ -172,6 +190,11 @@ namespace Swift
 		auto& window = Application::Get().GetWindow();
 		m_SwapChain = VulkanSwapChain::Create(m_VulkanInstance, m_Device);
 		m_SwapChain->Init(window.GetWidth(), window.GetHeight(), window.IsVSync());
+
+		{
+			VulkanCommand command = VulkanCommand(false); // Note(Jorben): Tracy begins & submits the commandbuffer itself for calibration
+			m_ProfilerContext = APP_PROFILE_GPU_CONTEXT(m_PhysicalDevice->GetVulkanPhysicalDevice(), m_Device->GetVulkanDevice(), m_Device->GetGraphicsQueue(), command.GetVulkanCommandBuffer());
+		}
 	}
 
 	void VulkanRenderer::BeginFrame()
@@ -179,7 +202,7 @@ namespace Swift
 		if (Application::Get().IsMinimized())
 			return;
 
-		Renderer::GetRenderData().Reset();
+		Renderer::GetCurrentRenderData().Reset();
 		m_ResourceFreeQueue.Execute();
 
 		auto& fences = VulkanTaskManager::GetFences();
@@ -188,7 +211,9 @@ namespace Swift
 			vkWaitForFences(m_Device->GetVulkanDevice(), (uint32_t)fences.size(), fences.data(), VK_TRUE, MAX_UINT64);
 			vkResetFences(m_Device->GetVulkanDevice(), (uint32_t)fences.size(), fences.data());
 		}
-		VulkanTaskManager::AddSemaphore(m_SwapChain->GetCurrentImageAvailableSemaphore());
+		// Note(Jorben): Offscreen images are available as soon as the fences are, so there is no acquire to wait on
+		if (!m_SwapChain->IsHeadless())
+			VulkanTaskManager::AddSemaphore(m_SwapChain->GetCurrentImageAvailableSemaphore());
 
 		m_SwapChain->BeginFrame();
 	}
@@ -217,24 +242,109 @@ namespace Swift
 		vkDeviceWaitIdle(m_Device->GetVulkanDevice());
 	}
 
-	void VulkanRenderer::Draw(Ref<CommandBuffer> commandBuffer, uint32_t verticeCount)
+	void VulkanRenderer::Draw(const Ref<CommandBuffer>& commandBuffer, uint32_t verticeCount)
 	{
 		APP_PROFILE_SCOPE("VulkanRenderer::Draw");
-		Renderer::GetRenderData().DrawCalls++;
+		auto& data = Renderer::GetCurrentRenderData();
+		data.DrawCalls++;
+		data.Triangles += verticeCount / 3;
+		data.Instances++;
 
-		auto cmdBuf = RefHelper::RefAs<VulkanCommandBuffer>(commandBuffer);
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
 		vkCmdDraw(cmdBuf->GetVulkanCommandBuffer(m_SwapChain->GetCurrentFrame()), verticeCount, 1, 0, 0);
 	}
 
-	void VulkanRenderer::DrawIndexed(Ref<CommandBuffer> commandBuffer, Ref<IndexBuffer> indexBuffer)
+	void VulkanRenderer::DrawIndexed(const Ref<CommandBuffer>& commandBuffer, const Ref<IndexBuffer>& indexBuffer)
 	{
 		APP_PROFILE_SCOPE("VulkanRenderer::DrawIndexed");
-		Renderer::GetRenderData().DrawCalls++;
+		auto& data = Renderer::GetCurrentRenderData();
+		data.DrawCalls++;
+		data.Triangles += indexBuffer->GetCount() / 3;
+		data.Instances++;
 
-		auto cmdBuf = RefHelper::RefAs<VulkanCommandBuffer>(commandBuffer);
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
 		vkCmdDrawIndexed(cmdBuf->GetVulkanCommandBuffer(m_SwapChain->GetCurrentFrame()), indexBuffer->GetCount(), 1, 0, 0, 0);
 	}
 
+	void VulkanRenderer::DrawBatch(const Ref<CommandBuffer>& commandBuffer, const Ref<Pipeline>& pipeline, std::span<const DrawCommand> commands)
+	{
+		APP_PROFILE_SCOPE("VulkanRenderer::DrawBatch");
+
+		uint32_t frame = m_SwapChain->GetCurrentFrame();
+
+		auto cmdBuf = RefHelper::RawAs<VulkanCommandBuffer>(commandBuffer);
+		VkCommandBuffer vkCmdBuf = cmdBuf->GetVulkanCommandBuffer(frame);
+		VkPipelineLayout layout = RefHelper::RawAs<VulkanPipeline>(pipeline)->GetVulkanLayout();
+
+		// Note(Jorben): Only what changes between consecutive commands gets bound
+		const VertexBuffer* boundVertexBuffer = nullptr;
+		const IndexBuffer* boundIndexBuffer = nullptr;
+		const DescriptorSet* boundSet = nullptr;
+		uint32_t boundDynamicOffset = 0;
+		uint32_t binds = 0;
+		uint32_t triangles = 0;
+		uint32_t instances = 0;
+
+		for (const DrawCommand& command : commands)
+		{
+			if (command.Set && (command.Set != boundSet || (command.DynamicOffsetCount && command.DynamicOffset != boundDynamicOffset)))
+			{
+				// Note(Jorben): DynamicOffset is a single value, so anything above 1 would read past the DrawCommand
+				APP_ASSERT((command.DynamicOffsetCount <= 1), "DrawCommand::DynamicOffsetCount can only be 0 or 1.");
+				uint32_t dynamicOffsetCount = std::min(command.DynamicOffsetCount, 1u);
+
+				VulkanDescriptorSet* set = static_cast<VulkanDescriptorSet*>(command.Set);
+				VkDescriptorSet vkSet = set->GetVulkanSet(frame);
+
+				set->GetWriter(frame).Flush(vkSet);
+				vkCmdBindDescriptorSets(vkCmdBuf, VK_PIPELINE_BIND_POINT_GRAPHICS, layout, set->GetSetID(), 1, &vkSet, dynamicOffsetCount, &command.DynamicOffset);
+
+				boundSet = command.Set;
+				boundDynamicOffset = command.DynamicOffset;
+				binds++;
+			}
+
+			if (command.Vertexbuffer && command.Vertexbuffer != boundVertexBuffer)
+			{
+				VkBuffer buffer = static_cast<VulkanVertexBuffer*>(command.Vertexbuffer)->GetVulkanBuffer();
+				VkDeviceSize offset = 0;
+				vkCmdBindVertexBuffers(vkCmdBuf, 0, 1, &buffer, &offset);
+
+				boundVertexBuffer = command.Vertexbuffer;
+				binds++;
+			}
+
+			if (command.Indexbuffer)
+			{
+				if (command.Indexbuffer != boundIndexBuffer)
+				{
+					vkCmdBindIndexBuffer(vkCmdBuf, static_cast<VulkanIndexBuffer*>(command.Indexbuffer)->GetVulkanBuffer(), 0, VK_INDEX_TYPE_UINT32);
+
+					boundIndexBuffer = command.Indexbuffer;
+					binds++;
+				}
+
+				vkCmdDrawIndexed(vkCmdBuf, command.Count, command.InstanceCount, command.First, command.VertexOffset, 0);
+			}
+			else
+			{
+				vkCmdDraw(vkCmdBuf, command.Count, command.InstanceCount, command.First, 0);
+			}
+
+			triangles += (command.Count / 3) * command.InstanceCount;
+			instances += command.InstanceCount;
+		}
+
+		// Note(Jorben): We recorded straight into the commandbuffer, so the tracked state is no longer reliable
+		cmdBuf->InvalidateState();
+
+		auto& data = Renderer::GetCurrentRenderData();
+		data.DrawCalls += (uint32_t)commands.size();
+		data.Triangles += triangles;
+		data.Instances += instances;
+		data.Binds += binds;
+	}
+
 	void VulkanRenderer::OnResize(uint32_t width, uint32_t height)
 	{
 		m_SwapChain->OnResize(width, height, Application::Get().GetWindow().IsVSync());